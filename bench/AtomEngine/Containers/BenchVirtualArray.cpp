@@ -0,0 +1,43 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Containers/DynamicArray.hpp"
+#include "AtomEngine/Containers/VirtualArray.hpp"
+
+using namespace Atom;
+
+TEST_CASE("VirtualArray: growth against DynamicArray")
+{
+    constexpr sizet count = 4 * 1024 * 1024;
+
+    BENCHMARK("DynamicArray InsertBack, count: " + std::to_string(count))
+    {
+        DynamicArray<sizet> array;
+        for (sizet i = 0; i < count; i++)
+        {
+            array.InsertBack(i);
+        }
+
+        return array.Count();
+    };
+
+    BENCHMARK("VirtualArray InsertBack, count: " + std::to_string(count))
+    {
+        VirtualArray<sizet> array(count);
+        for (sizet i = 0; i < count; i++)
+        {
+            array.InsertBack(i);
+        }
+
+        return array.Count();
+    };
+
+    BENCHMARK("VirtualArray InsertBack, huge pages, count: " + std::to_string(count))
+    {
+        VirtualArray<sizet> array(count, true);
+        for (sizet i = 0; i < count; i++)
+        {
+            array.InsertBack(i);
+        }
+
+        return array.Count();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
+#include "AtomEngine/Memory/ObjectPool.hpp"
+#include "AtomEngine/Memory/UniquePtr.hpp"
+
+using namespace Atom;
+
+struct Particle
+{
+    float position[3];
+    float velocity[3];
+};
+
+/// Creates and destroys \p{count} objects through TUniquePtr, with the pool reached by \p{policy}.
+template <typename PolicyT>
+sizet RunUniquePtrs(PolicyT policy, sizet count)
+{
+    sizet sum = 0;
+    for (sizet i = 0; i < count; i++)
+    {
+        TUniquePtr<Particle, PolicyT> ptr(policy.template Construct<Particle>(), policy);
+        sum += RCAST(sizet, &*ptr) & 0xff;
+    }
+
+    return sum;
+}
+
+TEST_CASE("AllocatorPolicy: virtual and inlined calls")
+{
+    constexpr sizet count = 100000;
+    TObjectPool<Particle> pool;
+
+    BENCHMARK("TUniquePtr, PolymorphicAllocatorPolicy, count: " + std::to_string(count))
+    {
+        return RunUniquePtrs(PolymorphicAllocatorPolicy(pool), count);
+    };
+
+    BENCHMARK("TUniquePtr, TAllocatorPolicy<TObjectPool>, count: " + std::to_string(count))
+    {
+        return RunUniquePtrs(TAllocatorPolicy<TObjectPool<Particle>>(pool), count);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <filesystem>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ArenaImage.hpp"
+#include "AtomEngine/Memory/GlobalAllocation.hpp"
+
+using namespace Atom;
+
+/// Node of a binary tree, built through create<T>.
+struct HeapNode
+{
+    sizet value;
+    HeapNode* left;
+    HeapNode* right;
+};
+
+/// Node of a binary tree, built inside an ArenaImage.
+struct ImageNode
+{
+    sizet value;
+    OffsetPtr<ImageNode> left;
+    OffsetPtr<ImageNode> right;
+};
+
+static HeapNode* BuildHeapTree(sizet depth, sizet& value)
+{
+    HeapNode* node = create<HeapNode>();
+    node->value = value++;
+    if (depth > 0)
+    {
+        node->left = BuildHeapTree(depth - 1, value);
+        node->right = BuildHeapTree(depth - 1, value);
+    }
+
+    return node;
+}
+
+static void DestroyHeapTree(HeapNode* node)
+{
+    if (node == nullptr) return;
+
+    DestroyHeapTree(node->left);
+    DestroyHeapTree(node->right);
+    destroy(node);
+}
+
+static ImageNode* BuildImageTree(ArenaImage& image, sizet depth, sizet& value)
+{
+    ImageNode* node = image.Construct<ImageNode>();
+    node->value = value++;
+    if (depth > 0)
+    {
+        node->left = BuildImageTree(image, depth - 1, value);
+        node->right = BuildImageTree(image, depth - 1, value);
+    }
+
+    return node;
+}
+
+static sizet SumTree(HeapNode* node)
+{
+    if (node == nullptr) return 0;
+
+    return node->value + SumTree(node->left) + SumTree(node->right);
+}
+
+static sizet SumTree(ImageNode* node)
+{
+    if (node == nullptr) return 0;
+
+    return node->value + SumTree(node->left.Get()) + SumTree(node->right.Get());
+}
+
+TEST_CASE("ArenaImage: loading an object graph")
+{
+    // 2^18 - 1 nodes
+    constexpr sizet depth = 17;
+    std::string path = (std::filesystem::temp_directory_path() / "BenchArenaImage.bin").string();
+
+    {
+        ArenaImage image(64 * 1024 * 1024);
+        sizet value = 0;
+        image.SetRoot(BuildImageTree(image, depth, value));
+        REQUIRE(image.Save(path.c_str()));
+    }
+
+    // both read every node, so the mapped image pays for its page faults
+    BENCHMARK("create<T>, build and read")
+    {
+        sizet value = 0;
+        HeapNode* root = BuildHeapTree(depth, value);
+        sizet sum = SumTree(root);
+        DestroyHeapTree(root);
+        return sum;
+    };
+
+    BENCHMARK("ArenaImage::Load, map and read")
+    {
+        ArenaImage image;
+        image.Load(path.c_str());
+        return SumTree(image.GetRoot<ImageNode>());
+    };
+
+    std::filesystem::remove(path);
+}
\ No newline at end of file
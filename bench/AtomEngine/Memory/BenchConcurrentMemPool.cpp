@@ -0,0 +1,92 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ConcurrentMemPool.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+
+using namespace Atom;
+
+/// HeapMemPool behind a single lock, the baseline ConcurrentMemPool == compared with.
+class LockedHeapMemPool
+{
+public:
+    memptr AllocateRaw(sizet size, bool clear)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        return _pool.AllocateRaw(size, clear);
+    }
+
+    void DeallocateRaw(memptr mem, sizet size)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pool.DeallocateRaw(mem, size);
+    }
+
+private:
+    std::mutex _lock;
+    HeapMemPool _pool{ 0 };
+};
+
+/// Each of \p{threadCount} threads allocates and deallocates \p{opCount} blocks,
+/// keeping a few blocks alive.
+template <typename PoolT>
+void RunThreads(PoolT& pool, sizet threadCount, sizet opCount)
+{
+    constexpr sizet liveCount = 64;
+
+    std::vector<std::thread> threads;
+    for (sizet i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&pool, opCount]
+        {
+            memptr blocks[liveCount] = { };
+            sizet sizes[liveCount] = { };
+            for (sizet j = 0; j < opCount; j++)
+            {
+                sizet slot = j % liveCount;
+                if (blocks[slot] != nullptr)
+                {
+                    pool.DeallocateRaw(blocks[slot], sizes[slot]);
+                }
+
+                sizes[slot] = 16 + (j % 64) * 16;
+                blocks[slot] = pool.AllocateRaw(sizes[slot], false);
+            }
+
+            for (sizet j = 0; j < liveCount; j++)
+            {
+                pool.DeallocateRaw(blocks[j], sizes[j]);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) thread.join();
+}
+
+TEST_CASE("ConcurrentMemPool: growing count of threads")
+{
+    constexpr sizet opCount = 10000;
+
+    ConcurrentMemPool concurrentPool(64 * 1024 * 1024);
+    LockedHeapMemPool lockedPool;
+
+    // each thread does the same amount of work, so with linear scaling
+    // the time stays the same as threads are added
+    for (sizet threadCount : { 1, 2, 4, 8 })
+    {
+        std::string suffix = ", ops per thread: " + std::to_string(opCount)
+            + ", threads: " + std::to_string(threadCount);
+
+        BENCHMARK("ConcurrentMemPool" + suffix)
+        {
+            RunThreads(concurrentPool, threadCount, opCount);
+        };
+
+        BENCHMARK("HeapMemPool, single lock" + suffix)
+        {
+            RunThreads(lockedPool, threadCount, opCount);
+        };
+    }
+}
\ No newline at end of file
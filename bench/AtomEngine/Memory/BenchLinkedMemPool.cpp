@@ -0,0 +1,61 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+
+using namespace Atom;
+
+TEST_CASE("LinkedMemPool: DeallocateRaw with growing count of live blocks")
+{
+    constexpr sizet blockSize = 32;
+
+    for (sizet liveCount : { 1000, 10000, 100000 })
+    {
+        HeapMemPool pool(liveCount * blockSize * 2);
+
+        memptr mem = nullptr;
+        for (sizet i = 0; i < liveCount; i++)
+        {
+            memptr block = pool.AllocateRaw(blockSize, false);
+            if (i == liveCount / 2)
+            {
+                mem = block;
+            }
+        }
+
+        BENCHMARK("DeallocateRaw + AllocateRaw, live blocks: " + std::to_string(liveCount))
+        {
+            pool.DeallocateRaw(mem, blockSize);
+            mem = pool.AllocateRaw(blockSize, false);
+            return mem;
+        };
+    }
+}
+
+
+TEST_CASE("LinkedMemPool: AllocateBatch against AllocateRaw in a loop")
+{
+    constexpr sizet blockSize = 64;
+    constexpr sizet count = 10000;
+
+    HeapMemPool pool(count * blockSize * 4);
+    memptr* mems = new memptr[count];
+
+    BENCHMARK("AllocateRaw in a loop, blocks: " + std::to_string(count))
+    {
+        for (sizet i = 0; i < count; i++)
+        {
+            mems[i] = pool.AllocateRaw(blockSize, false);
+        }
+
+        pool.DeallocateBatch(mems, count, blockSize);
+        return mems[0];
+    };
+
+    BENCHMARK("AllocateBatch, blocks: " + std::to_string(count))
+    {
+        pool.AllocateBatch(blockSize, count, mems, false);
+        pool.DeallocateBatch(mems, count, blockSize);
+        return mems[0];
+    };
+
+    delete[] mems;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <string>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/ThreadCacheAllocator.hpp"
+#include "AtomEngine/Memory/ProfilingAllocator.hpp"
+
+using namespace Atom;
+
+/// Allocates and deallocates blocks of mixed sizes, keeping some of them alive.
+static void AllocateMixed(IAllocator& allocator, sizet opCount)
+{
+    constexpr sizet liveCount = 64;
+    memptr blocks[liveCount] = { };
+
+    for (sizet i = 0; i < opCount; i++)
+    {
+        memptr& block = blocks[i % liveCount];
+        if (block != nullptr)
+        {
+            allocator.DeallocateRaw(block, 0);
+        }
+
+        block = allocator.AllocateRaw(16 + (i % 16) * 16, false);
+    }
+
+    for (memptr block : blocks)
+    {
+        allocator.DeallocateRaw(block, 0);
+    }
+}
+
+TEST_CASE("ProfilingAllocator: overhead over ThreadCacheAllocator")
+{
+    constexpr sizet opCount = 10000;
+
+    HeapMemPool pool(1024 * 1024);
+    ThreadCacheAllocator backing(pool);
+
+    BENCHMARK("not profiled, ops: " + std::to_string(opCount))
+    {
+        AllocateMixed(backing, opCount);
+    };
+
+    ProfilingAllocator tagProfiler(backing, 0);
+    BENCHMARK("tags only, ops: " + std::to_string(opCount))
+    {
+        ProfilingAllocator::TagScope scope("Bench");
+        AllocateMixed(tagProfiler, opCount);
+    };
+
+    for (sizet sampleInterval : { 1, 64 })
+    {
+        ProfilingAllocator stackProfiler(backing, 8, sampleInterval);
+        BENCHMARK("8 frames, sampled 1 in " + std::to_string(sampleInterval)
+            + ", ops: " + std::to_string(opCount))
+        {
+            AllocateMixed(stackProfiler, opCount);
+        };
+    }
+}
\ No newline at end of file
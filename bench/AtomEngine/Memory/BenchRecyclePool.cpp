@@ -0,0 +1,59 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/RecyclePool.hpp"
+
+using namespace Atom;
+
+/// Fills its buffer on each use, like a message or a path query.
+struct Query
+{
+    void Reset()
+    {
+        values.Clear();
+    }
+
+    DynamicArray<sizet> values;
+};
+
+TEST_CASE("RecyclePool: reuse against construction")
+{
+    constexpr sizet count = 10000;
+    constexpr sizet valueCount = 64;
+
+    BENCHMARK("Construct and Destruct, count: " + std::to_string(count))
+    {
+        sizet sum = 0;
+        for (sizet i = 0; i < count; i++)
+        {
+            Query* query = DefaultAllocatorInstance.Construct<Query>();
+            for (sizet j = 0; j < valueCount; j++)
+            {
+                query->values.InsertBack(j);
+            }
+
+            sum += query->values.Count();
+            DefaultAllocatorInstance.Destruct(query);
+        }
+
+        return sum;
+    };
+
+    TRecyclePool<Query> pool(16);
+
+    BENCHMARK("Acquire and Release, count: " + std::to_string(count))
+    {
+        sizet sum = 0;
+        for (sizet i = 0; i < count; i++)
+        {
+            Query* query = pool.Acquire();
+            for (sizet j = 0; j < valueCount; j++)
+            {
+                query->values.InsertBack(j);
+            }
+
+            sum += query->values.Count();
+            pool.Release(query);
+        }
+
+        return sum;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include <thread>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/GlobalAllocation.hpp"
+
+using namespace Atom;
+
+TEST_CASE("ThreadCacheAllocator: globalAllocator with growing count of threads")
+{
+    constexpr sizet opCount = 10000;
+    constexpr sizet liveCount = 64;
+
+    // each thread does the same amount of work, so with linear scaling
+    // the time stays the same as threads are added
+    for (sizet threadCount : { 1, 2, 4, 8 })
+    {
+        BENCHMARK("alloc + dealloc, ops per thread: " + std::to_string(opCount)
+            + ", threads: " + std::to_string(threadCount))
+        {
+            std::vector<std::thread> threads;
+            for (sizet i = 0; i < threadCount; i++)
+            {
+                threads.emplace_back([]
+                {
+                    memptr blocks[liveCount] = { };
+                    for (sizet j = 0; j < opCount; j++)
+                    {
+                        memptr& block = blocks[j % liveCount];
+                        if (block != nullptr)
+                        {
+                            dealloc(block, 0);
+                        }
+
+                        block = alloc(16 + (j % 16) * 16);
+                    }
+
+                    for (memptr block : blocks)
+                    {
+                        dealloc(block, 0);
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) thread.join();
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include <iostream>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/VirtualMemPool.hpp"
+
+#if defined(ATOM_PLATFORM_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace Atom;
+
+/// Counts page faults and data TLB misses of the current thread, where supported.
+class MemoryCounters
+{
+public:
+    MemoryCounters()
+    {
+#if defined(ATOM_PLATFORM_LINUX)
+        perf_event_attr attr = { };
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+
+        _tlbFd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~MemoryCounters()
+    {
+#if defined(ATOM_PLATFORM_LINUX)
+        if (_tlbFd >= 0) close(_tlbFd);
+#endif
+    }
+
+    void Start()
+    {
+        _faults = _ReadFaults();
+
+#if defined(ATOM_PLATFORM_LINUX)
+        if (_tlbFd >= 0)
+        {
+            ioctl(_tlbFd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_tlbFd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void Stop(const std::string& name)
+    {
+        long faults = _ReadFaults() - _faults;
+        std::cout << name << ": page faults: " << faults;
+
+#if defined(ATOM_PLATFORM_LINUX)
+        long long tlbMisses = 0;
+        if (_tlbFd >= 0)
+        {
+            ioctl(_tlbFd, PERF_EVENT_IOC_DISABLE, 0);
+            read(_tlbFd, &tlbMisses, sizeof(tlbMisses));
+            std::cout << ", dTLB misses: " << tlbMisses;
+        }
+        else
+        {
+            std::cout << ", dTLB misses: unavailable";
+        }
+#endif
+
+        std::cout << std::endl;
+    }
+
+private:
+    static long _ReadFaults()
+    {
+#if defined(ATOM_PLATFORM_LINUX)
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_minflt + usage.ru_majflt;
+#else
+        return 0;
+#endif
+    }
+
+private:
+    long _faults = 0;
+    int _tlbFd = -1;
+};
+
+/// Allocates \p{size} memory in blocks, touches every page, then reads memory at random.
+template <typename PoolT>
+void RunLargePoolWorkload(PoolT& pool, const std::string& name, sizet size)
+{
+    constexpr sizet blockSize = 64 * 1024;
+    constexpr sizet readCount = 1 << 22;
+
+    MemoryCounters counters;
+    counters.Start();
+
+    sizet blockCount = size / blockSize;
+    memptr* blocks = new memptr[blockCount];
+    for (sizet i = 0; i < blockCount; i++)
+    {
+        blocks[i] = pool.AllocateRaw(blockSize, true);
+    }
+
+    sizet sum = 0;
+    sizet index = 1;
+    for (sizet i = 0; i < readCount; i++)
+    {
+        index = index * 6364136223846793005ull + 1442695040888963407ull;
+        memptr block = blocks[(index >> 33) % blockCount];
+        sum += SCAST(sizet, block[(index >> 17) % blockSize]);
+    }
+
+    counters.Stop(name);
+
+    for (sizet i = 0; i < blockCount; i++)
+    {
+        pool.DeallocateRaw(blocks[i], blockSize);
+    }
+
+    delete[] blocks;
+    REQUIRE(sum == 0);
+}
+
+TEST_CASE("VirtualMemPool: page faults and TLB misses of large pools")
+{
+    constexpr sizet poolSize = 256 * 1024 * 1024;
+
+    {
+        HeapMemPool pool(0);
+        RunLargePoolWorkload(pool, "HeapMemPool", poolSize);
+    }
+
+    {
+        VirtualMemPool pool(poolSize * 2);
+        RunLargePoolWorkload(pool, "VirtualMemPool", poolSize);
+    }
+
+    {
+        VirtualMemPool pool(poolSize * 2, 0, true);
+        RunLargePoolWorkload(pool, "VirtualMemPool, huge pages", poolSize);
+    }
+}
+
+TEST_CASE("VirtualMemPool: allocation")
+{
+    VirtualMemPool pool(1024 * 1024 * 1024);
+
+    BENCHMARK("AllocateRaw + DeallocateRaw, 64 KiB")
+    {
+        memptr mem = pool.AllocateRaw(64 * 1024, false);
+        pool.DeallocateRaw(mem, 64 * 1024);
+        return mem;
+    };
+}
\ No newline at end of file
@@ -5,4 +5,6 @@
 #include "AtomEngine/Containers/ICollection.hpp"
 #include "AtomEngine/Containers/IList.hpp"
 #include "AtomEngine/Containers/IArray.hpp"
-#include "AtomEngine/Containers/StackArray.hpp"
\ No newline at end of file
+#include "AtomEngine/Containers/StackArray.hpp"
+#include "AtomEngine/Containers/SlotMap.hpp"
+#include "AtomEngine/Containers/VirtualArray.hpp"
\ No newline at end of file
@@ -1,17 +1,19 @@
 #pragma once
 #include "AtomEngine/Core.hpp"
 #include "AtomEngine/Memory/IAllocator.hpp"
-#include "AtomEngine/Memory/DefaultAllocator.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
 #include "AtomEngine/Containers/IDynamicArray.hpp"
 #include "AtomEngine/Containers/Internal/ArrayImpl.hpp"
 
 namespace Atom
 {
-    template <typename ElementT>
+    /// @tparam ElementT Type of element this array contains.
+    /// @tparam AllocatorPolicyT Policy used to reach the allocator, see AllocatorPolicy.hpp.
+    template <typename ElementT, typename AllocatorPolicyT = PolymorphicAllocatorPolicy>
     class DynamicArray: public Internal::ArrayImpl<ElementT>,
         public IDynamicArray<ElementT>
     {
-        using ThisT = DynamicArray<ElementT>;
+        using ThisT = DynamicArray<ElementT, AllocatorPolicyT>;
         using BaseT = Internal::ArrayImpl<ElementT>;
         using IIteratorT = IIterator<ElementT>;
         using IConstIterableT = IConstIterable<ElementT>;
@@ -21,8 +23,17 @@ namespace Atom
 
     /// ----------------------------------------------------------------------------
     public:
-        DynamicArray() noexcept:
-            _allocator(DefaultAllocatorInstance)
+        DynamicArray() noexcept
+        {
+            _array = nullptr;
+            _count = 0;
+            _capacity = 0;
+        }
+
+        /// @param allocator Allocator used to allocate elements, an IAllocator converts to
+        ///     the default policy. The allocator must outlive the array.
+        DynamicArray(AllocatorPolicyT allocator) noexcept:
+            _allocator(allocator)
         {
             _array = nullptr;
             _count = 0;
@@ -86,7 +97,14 @@ namespace Atom
             count = max(count, _count);
             if (count != _capacity)
             {
-                _array = _allocator.Reallocate<ElementT>(_array, count);
+                ElementT* array = _allocator.template Reallocate<ElementT>(_array, count);
+                if (array == nullptr and count > 0)
+                {
+                    throw std::bad_alloc();
+                }
+
+                _array = array;
+                _capacity = count;
             }
         }
 
@@ -94,7 +112,7 @@ namespace Atom
         {
             if (_capacity - _count < count)
             {
-                _allocator.Reallocate<ElementT>(_array, _capacity - _count + count);
+                Resize(_count + count);
             }
 
             return _capacity - _count;
@@ -105,11 +123,21 @@ namespace Atom
             return Resize(_count);
         }
 
+    protected:
+        /// Grows the array geometrically, so that inserting at the back == amortized O(1).
+        void _AssertCapacityFor(sizet count) override final
+        {
+            if (count > _capacity - _count)
+            {
+                Resize(max(_capacity * 2, _count + count));
+            }
+        }
+
     protected:
         using BaseT::_array;
         using BaseT::_count;
         using BaseT::_capacity;
 
-        IAllocator& _allocator;
+        AllocatorPolicyT _allocator;
     };
 }
\ No newline at end of file
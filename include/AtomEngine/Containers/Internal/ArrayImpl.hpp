@@ -23,6 +23,10 @@ namespace Atom::Internal
         /// @todo Resolve ambiguity between IConstCollection::Count and ConstArrayImpl::Count.
         using BaseT::Count;
 
+        /// Const overloads are hidden by the overloads below otherwise.
+        using BaseT::Data;
+        using BaseT::operator[];
+
     /// ----------------------------------------------------------------------------
     /// IArray
     public:
@@ -76,8 +80,8 @@ namespace Atom::Internal
         {
             _AssertIndexIsInBounds(0);
 
-            _array[_count] = ElementT();
             _count--;
+            _array[_count] = ElementT();
         }
 
         void InsertAt(sizet index, IConstIteratorT& it, sizet count) override final
@@ -113,7 +117,9 @@ namespace Atom::Internal
 
         void RemoveFrom(sizet from, sizet to) override final
         {
-            sizet count = to - from;
+            if (from >= _count or to < from) return;
+
+            sizet count = min(to, _count - 1) - from + 1;
             for (sizet i = from; i < (_count - count); i++)
             {
                 _array[i] = _array[i + count];
@@ -168,11 +174,11 @@ namespace Atom::Internal
         /// @param count count of elements to insert
         /// @note this function == called every time any number
         /// of elements are to be inserted irrelevance of their position
-        void _AssertCapacityFor(sizet count) const
+        virtual void _AssertCapacityFor(sizet count)
         {
-            if (_count >= _capacity)
+            if (count > _capacity - _count)
             {
-                throw std::runtime_error("could not allocate memory for " + (_count + 1));
+                throw std::runtime_error("could not allocate memory for elements");
             }
         }
 
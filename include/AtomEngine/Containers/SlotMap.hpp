@@ -0,0 +1,191 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/Handle.hpp"
+#include "AtomEngine/Containers/DynamicArray.hpp"
+#include "AtomEngine/Containers/ArrayView.hpp"
+
+namespace Atom
+{
+    /// Stores elements densely and references them by keys, which detect erased elements.
+    ///
+    /// Elements live in a contiguous array, so iteration == as fast as over an array.
+    /// A key == the index of a slot in the sparse slot array and the generation of that slot,
+    /// the slot stores the index of the element in the dense array. Erasing moves the last
+    /// element into the hole and bumps the generation of the slot, so keys to erased elements
+    /// never find another element.
+    ///
+    /// @tparam ElementT Type of element this map contains.
+    ///
+    /// @note
+    /// - Ptrs to elements are invalidated by Insert() and Erase(), keys are not.
+    /// - DynamicArray moves elements by copying their memory when it grows,
+    ///   so elements must not store ptrs into themselves.
+    /// - ElementT must be equality comparable, as DynamicArray requires.
+    template <typename ElementT>
+    class SlotMap
+    {
+        using ThisT = SlotMap<ElementT>;
+
+    public:
+        using KeyT = THandle<ElementT>;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Entry of the sparse array.
+        struct Slot
+        {
+            /// Index of the element in the dense array, or the next free slot if free.
+            uint denseIndex;
+            uint generation;
+
+            /// Required by DynamicArray.
+            bool operator == (const Slot& other) const noexcept
+            {
+                return denseIndex == other.denseIndex and generation == other.generation;
+            }
+        };
+
+        static constexpr uint NullIndex = SCAST(uint, -1);
+
+    /// ----------------------------------------------------------------------------
+    public:
+        SlotMap() noexcept { }
+
+        /// @param allocator Allocator used to allocate elements and slots, must outlive the map.
+        SlotMap(IAllocator& allocator) noexcept:
+            _values(allocator), _denseToSlot(allocator), _slots(allocator) { }
+
+        SlotMap(const ThisT& other) = delete;
+        ThisT& operator = (const ThisT& other) = delete;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of elements.
+        sizet Count() const noexcept
+        {
+            return _values.Count();
+        }
+
+        /// Inserts the element in O(1).
+        ///
+        /// @return Key to the element.
+        KeyT Insert(const ElementT& element)
+        {
+            uint slotIndex = _AcquireSlot();
+            Slot& slot = _slots[slotIndex];
+            slot.denseIndex = SCAST(uint, _values.Count());
+
+            _values.InsertBack(element);
+            _denseToSlot.InsertBack(slotIndex);
+
+            return { slotIndex, slot.generation };
+        }
+
+        /// Erases the element in O(1), the last element moves into its place.
+        ///
+        /// @return @true if erased, @false if \p{key} == null or stale.
+        bool Erase(KeyT key)
+        {
+            if (Contains(key) != true) return false;
+
+            Slot& slot = _slots[key.index];
+            uint lastIndex = SCAST(uint, _values.Count() - 1);
+            if (slot.denseIndex != lastIndex)
+            {
+                _values[slot.denseIndex] = move(_values[lastIndex]);
+
+                uint lastSlot = _denseToSlot[lastIndex];
+                _denseToSlot[slot.denseIndex] = lastSlot;
+                _slots[lastSlot].denseIndex = slot.denseIndex;
+            }
+
+            _values.RemoveBack();
+            _denseToSlot.RemoveBack();
+
+            slot.generation = slot.generation + 1 != 0 ? slot.generation + 1 : 1;
+            slot.denseIndex = _freeSlot;
+            _freeSlot = key.index;
+            return true;
+        }
+
+        /// Erases all elements, every key becomes stale.
+        void Clear()
+        {
+            while (_values.Count() > 0)
+            {
+                Erase(KeyAt(_values.Count() - 1));
+            }
+        }
+
+        /// Does \p{key} refer to an element?
+        bool Contains(KeyT key) const noexcept
+        {
+            return key.generation != 0 and key.index < _slots.Count()
+                and _slots[key.index].generation == key.generation;
+        }
+
+        /// Ptr to the element, @nullptr if \p{key} == null or stale.
+        ElementT* Get(KeyT key) noexcept
+        {
+            return Contains(key) ? &_values[_slots[key.index].denseIndex] : nullptr;
+        }
+
+        /// Ptr to the element, @nullptr if \p{key} == null or stale.
+        const ElementT* Get(KeyT key) const noexcept
+        {
+            return Contains(key) ? &_values[_slots[key.index].denseIndex] : nullptr;
+        }
+
+        /// Key of the element at \p{denseIndex} of the dense array.
+        KeyT KeyAt(sizet denseIndex) const noexcept
+        {
+            uint slotIndex = _denseToSlot[denseIndex];
+            return { slotIndex, _slots[slotIndex].generation };
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Dense array of elements, in no particular order.
+        ArrayView<ElementT> Values() const noexcept
+        {
+            return ArrayView<ElementT>(_values.Data(), _values.Count());
+        }
+
+        /// Ptr to the dense array of elements, to modify elements while iterating.
+        ElementT* Data() noexcept
+        {
+            return _values.Data();
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Takes a free slot, or adds a new one.
+        uint _AcquireSlot()
+        {
+            if (_freeSlot != NullIndex)
+            {
+                uint slotIndex = _freeSlot;
+                _freeSlot = _slots[slotIndex].denseIndex;
+                return slotIndex;
+            }
+
+            if (_slots.Count() >= NullIndex)
+            {
+                throw std::length_error("SlotMap: too many elements.");
+            }
+
+            _slots.InsertBack(Slot{ 0, 1 });
+            return SCAST(uint, _slots.Count() - 1);
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        DynamicArray<ElementT> _values;
+
+        /// Slot index of each element of the dense array.
+        DynamicArray<uint> _denseToSlot;
+
+        DynamicArray<Slot> _slots;
+        uint _freeSlot = NullIndex;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+#include "AtomEngine/Containers/IDynamicArray.hpp"
+#include "AtomEngine/Containers/Internal/ArrayImpl.hpp"
+
+namespace Atom
+{
+    /// Array which reserves address space for its maximum count up front, and commits pages
+    /// of it as it grows.
+    ///
+    /// Unlike DynamicArray, growing never reallocates, so elements are never copied and
+    /// ptrs to them stay valid until the elements are removed. Pages are backed by memory
+    /// only when first touched, so the reservation costs only address space.
+    ///
+    /// @tparam ElementT Type of element this array contains.
+    ///
+    /// @note
+    /// - Inserting beyond MaxCount() throws std::length_error.
+    /// - ShrinkToFit() decommits pages after the last element.
+    template <typename ElementT>
+    class VirtualArray: public Internal::ArrayImpl<ElementT>,
+        public IDynamicArray<ElementT>
+    {
+        using ThisT = VirtualArray<ElementT>;
+        using BaseT = Internal::ArrayImpl<ElementT>;
+
+        static_assert(alignof(ElementT) <= 4096,
+            "VirtualArray: ElementT cannot be aligned beyond a page.");
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Reserves address space for \p{maxCount} elements, nothing == committed yet.
+        ///
+        /// @param maxCount Count of elements the array can grow to.
+        /// @param hugePages If true, asks the system to back the array by huge pages,
+        ///     which reduces page faults and TLB misses for large arrays.
+        VirtualArray(sizet maxCount, bool hugePages = false) noexcept:
+            _hugePages(hugePages and GetHugePageSize() != 0)
+        {
+            _granularity = _hugePages ? GetHugePageSize() : GetPageSize();
+
+            _array = nullptr;
+            _count = 0;
+            _capacity = 0;
+
+            if (maxCount == 0 or maxCount > NPOS / sizeof(ElementT)) return;
+
+            sizet size = AlignUp(maxCount * sizeof(ElementT), _granularity);
+            memptr mem = ReserveVirtualMemory(size, _granularity);
+            if (mem == nullptr) return;
+
+            _array = RCAST(ElementT*, mem);
+            _reserveSize = size;
+            _maxCount = maxCount;
+        }
+
+        VirtualArray(const ThisT& other) = delete;
+        ThisT& operator = (const ThisT& other) = delete;
+
+        ~VirtualArray()
+        {
+            if (_array != nullptr)
+            {
+                Clear();
+                ReleaseVirtualMemory(RCAST(memptr, _array), _reserveSize);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of elements address space == reserved for.
+        sizet MaxCount() const noexcept
+        {
+            return _maxCount;
+        }
+
+        /// Count of memory units committed for elements.
+        sizet CommittedCount() const noexcept
+        {
+            return _committed;
+        }
+
+    /// ----------------------------------------------------------------------------
+    /// IDynamicCollection
+    public:
+        using BaseT::Clear;
+
+        /// Commits or decommits pages, so that capacity covers \p{count} elements.
+        /// Elements stay in place.
+        void Resize(sizet count) override final
+        {
+            count = max(count, _count);
+            if (count > _maxCount)
+            {
+                throw std::length_error("VirtualArray: count exceeds the reserved range.");
+            }
+
+            memptr mem = RCAST(memptr, _array);
+            sizet size = AlignUp(count * sizeof(ElementT), _granularity);
+            if (size > _committed)
+            {
+                // committed pages are either fresh or decommitted before, both read 0
+                if (CommitVirtualMemory(mem + _committed, size - _committed, _hugePages) != true)
+                {
+                    throw std::bad_alloc();
+                }
+            }
+            else if (size < _committed)
+            {
+                DecommitVirtualMemory(mem + size, _committed - size);
+            }
+
+            _committed = size;
+            _capacity = min(size / sizeof(ElementT), _maxCount);
+        }
+
+        sizet Reserve(sizet count) override final
+        {
+            if (_capacity - _count < count)
+            {
+                Resize(_count + count);
+            }
+
+            return _capacity - _count;
+        }
+
+        void ShrinkToFit() override final
+        {
+            return Resize(_count);
+        }
+
+    protected:
+        /// Grows the committed range geometrically, to keep count of commit calls low.
+        /// Pages are backed lazily, so this costs no memory until elements reach them.
+        void _AssertCapacityFor(sizet count) override final
+        {
+            if (count > _capacity - _count)
+            {
+                Resize(min(max(_capacity * 2, _count + count), max(_maxCount, _count + count)));
+            }
+        }
+
+    protected:
+        using BaseT::_array;
+        using BaseT::_count;
+        using BaseT::_capacity;
+
+        sizet _reserveSize = 0;
+        sizet _committed = 0;
+        sizet _maxCount = 0;
+        sizet _granularity;
+        bool _hugePages;
+    };
+}
\ No newline at end of file
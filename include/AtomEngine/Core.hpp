@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 #include <type_traits>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
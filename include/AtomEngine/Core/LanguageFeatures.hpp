@@ -18,6 +18,6 @@
 #define SASSERT static_assert
 #define STHROW(msg) SASSERT(false, msg)
 
-void ASSERT(bool assertion, const char* msg)
+inline void ASSERT(bool assertion, const char* msg)
 {
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include "AtomEngine/Core/LanguageFeatures.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 /// ----------------------------------------------------------------------------
 // BASE TYPES
 
@@ -56,9 +60,40 @@ namespace Atom
     template <typename T>
     void swap(T& lhs, T& rhs) noexcept
     {
-        T& tmp = lhs;
-        lhs = rhs;
-        rhs = tmp;
+        T tmp = move(lhs);
+        lhs = move(rhs);
+        rhs = move(tmp);
+    }
+
+    /// Count of bits in \p{sizet}.
+    constexpr sizet SizeTBitCount = sizeof(sizet) * 8;
+
+    /// Index of the least significant set bit of \p{value}.
+    /// 
+    /// @param value Value to scan, must not be 0.
+    inline sizet CountTrailingZeros(sizet value) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
+    /// Index of the most significant set bit of \p{value}.
+    /// 
+    /// @param value Value to scan, must not be 0.
+    inline sizet HighestBitIndex(sizet value) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return index;
+#else
+        return SizeTBitCount - 1 - __builtin_clzll(value);
+#endif
     }
 }
 
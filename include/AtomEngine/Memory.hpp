@@ -2,10 +2,28 @@
 #include "AtomEngine/Memory/Core.hpp"
 #include "AtomEngine/Memory/UniqueBox.hpp"
 #include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
 #include "AtomEngine/Memory/IMemPool.hpp"
+#include "AtomEngine/Memory/MemPoolStats.hpp"
 #include "AtomEngine/Memory/LinkedMemPool.hpp"
 #include "AtomEngine/Memory/StackMemPool.hpp"
 #include "AtomEngine/Memory/HeapMemPool.hpp"
 #include "AtomEngine/Memory/BufHeapMemPool.hpp"
+#include "AtomEngine/Memory/Handle.hpp"
+#include "AtomEngine/Memory/VirtualMemPool.hpp"
+#include "AtomEngine/Memory/ConcurrentMemPool.hpp"
+#include "AtomEngine/Memory/HandleMemPool.hpp"
+#include "AtomEngine/Memory/ObjectPool.hpp"
+#include "AtomEngine/Memory/RecyclePool.hpp"
+#include "AtomEngine/Memory/ThreadCacheAllocator.hpp"
+#include "AtomEngine/Memory/ProfilingAllocator.hpp"
+#include "AtomEngine/Memory/MemoryTag.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+#include "AtomEngine/Memory/FrameAllocator.hpp"
+#include "AtomEngine/Memory/StackAllocator.hpp"
+#include "AtomEngine/Memory/DoubleStackAllocator.hpp"
+#include "AtomEngine/Memory/ScratchScope.hpp"
+#include "AtomEngine/Memory/ArenaImage.hpp"
 #include "AtomEngine/Memory/GlobalAllocation.hpp"
-#include "AtomEngine/Memory/Ptr.hpp"
\ No newline at end of file
+#include "AtomEngine/Memory/Ptr.hpp"
+#include "AtomEngine/Memory/OffsetPtr.hpp"
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+#include "AtomEngine/Memory/GlobalAllocation.hpp"
+
+namespace Atom
+{
+    /// Allocator policies are passed as template parameters to containers and smart ptrs,
+    /// and decide how they reach their allocator.
+    ///
+    /// A policy provides AllocateRaw(), ReallocateRaw() and DeallocateRaw() with the same
+    /// meaning as those of IAllocator, TAllocatorPolicyBase adds typed helpers over them.
+    /// PolymorphicAllocatorPolicy selects the allocator at runtime through IAllocator,
+    /// TAllocatorPolicy calls a concrete allocator type, so its calls can be inlined.
+
+    /// Typed helpers shared by allocator policies, implemented over raw functions of \p{PolicyT}.
+    ///
+    /// @tparam PolicyT Policy deriving from this type.
+    template <typename PolicyT>
+    class TAllocatorPolicyBase
+    {
+    public:
+        /// @see IAllocator::Construct()
+        template <typename T, typename... ArgsT>
+        T* Construct(ArgsT&&... args)
+        {
+            T* mem = RCAST(T*, _Policy().AllocateRaw(sizeof(T), true, alignof(T)));
+            if (mem != nullptr)
+            {
+                new(mem) T(forward<ArgsT>(args)...);
+            }
+
+            return mem;
+        }
+
+        /// @see IAllocator::Destruct()
+        template <typename T>
+        void Destruct(T* mem)
+        {
+            if (mem != nullptr)
+            {
+                try
+                {
+                    mem->T::~T();
+                }
+                catch (const std::exception&)
+                {
+                }
+
+                _Policy().DeallocateRaw(RCAST(memptr, mem), sizeof(T));
+            }
+        }
+
+        /// @see IAllocator::Reallocate()
+        template <typename T>
+        T* Reallocate(T* mem, sizet count)
+        {
+            return RCAST(T*, _Policy().ReallocateRaw(RCAST(memptr, mem), count * sizeof(T),
+                true, false, alignof(T)));
+        }
+
+    protected:
+        PolicyT& _Policy() noexcept
+        {
+            return *SCAST(PolicyT*, this);
+        }
+    };
+
+    /// Calls the allocator through IAllocator, so the allocator can be selected at runtime.
+    class PolymorphicAllocatorPolicy: public TAllocatorPolicyBase<PolymorphicAllocatorPolicy>
+    {
+    public:
+        /// Uses DefaultAllocatorInstance.
+        PolymorphicAllocatorPolicy() noexcept:
+            _allocator(&DefaultAllocatorInstance) { }
+
+        /// @param allocator Allocator to call, must outlive the policy.
+        PolymorphicAllocatorPolicy(IAllocator& allocator) noexcept:
+            _allocator(&allocator) { }
+
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign)
+        {
+            return _allocator->AllocateRaw(size, clear, align);
+        }
+
+        memptr ReallocateRaw(memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign)
+        {
+            return _allocator->ReallocateRaw(mem, size, clear, clearAll, align);
+        }
+
+        void DeallocateRaw(memptr mem, sizet size)
+        {
+            _allocator->DeallocateRaw(mem, size);
+        }
+
+        IAllocator& GetAllocator() const noexcept
+        {
+            return *_allocator;
+        }
+
+    protected:
+        IAllocator* _allocator;
+    };
+
+    /// Calls functions of \p{AllocatorT} directly, without virtual dispatch,
+    /// so that they can be inlined.
+    ///
+    /// @tparam AllocatorT Concrete allocator type, functions of its derived types are not called.
+    template <typename AllocatorT>
+    class TAllocatorPolicy: public TAllocatorPolicyBase<TAllocatorPolicy<AllocatorT>>
+    {
+    public:
+        /// @param allocator Allocator to call, must outlive the policy.
+        TAllocatorPolicy(AllocatorT& allocator) noexcept:
+            _allocator(&allocator) { }
+
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign)
+        {
+            return _allocator->AllocatorT::AllocateRaw(size, clear, align);
+        }
+
+        memptr ReallocateRaw(memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign)
+        {
+            return _allocator->AllocatorT::ReallocateRaw(mem, size, clear, clearAll, align);
+        }
+
+        void DeallocateRaw(memptr mem, sizet size)
+        {
+            _allocator->AllocatorT::DeallocateRaw(mem, size);
+        }
+
+        AllocatorT& GetAllocator() const noexcept
+        {
+            return *_allocator;
+        }
+
+    protected:
+        AllocatorT* _allocator;
+    };
+
+    /// Calls globalAllocator directly, instead of through DefaultAllocatorInstance
+    /// which forwards every call to it. Stores no state.
+    class GlobalAllocatorPolicy: public TAllocatorPolicyBase<GlobalAllocatorPolicy>
+    {
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign)
+        {
+            return globalAllocator->AllocateRaw(size, clear, align);
+        }
+
+        memptr ReallocateRaw(memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign)
+        {
+            return globalAllocator->ReallocateRaw(mem, size, clear, clearAll, align);
+        }
+
+        void DeallocateRaw(memptr mem, sizet size)
+        {
+            globalAllocator->DeallocateRaw(mem, size);
+        }
+    };
+}
\ No newline at end of file
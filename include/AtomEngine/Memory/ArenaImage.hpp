@@ -0,0 +1,194 @@
+#pragma once
+#include <cstdio>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+#include "AtomEngine/Memory/OffsetPtr.hpp"
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+
+namespace Atom
+{
+    /// ArenaImage == a LinearAllocator whose memory can be saved to a file and mapped back.
+    ///
+    /// Objects allocated from the arena refer to each other through OffsetPtr, so the image
+    /// stays valid at any address. Load() maps the file in a single call, objects are read
+    /// from the file on first access without being constructed again.
+    ///
+    /// The image == laid out as \p{[Header][objects]}, starting at a page boundary both
+    /// in memory and in the file, so objects keep their alignment when mapped.
+    ///
+    /// @note
+    /// - Objects must not store raw ptrs or virtual tables, those hold addresses.
+    /// - Objects are never destructed, like with any LinearAllocator.
+    /// - A loaded image == full, its objects can be modified but no more can be allocated.
+    class ArenaImage: public LinearAllocator
+    {
+        using BaseT = LinearAllocator;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Placed at the start of the image.
+        struct Header
+        {
+            char magic[8];
+
+            /// Count of memory units of objects.
+            sizet size;
+
+            /// Offset of the root object from the first object, NPOS if not set.
+            sizet rootOffset;
+        };
+
+        static constexpr char Magic[8] = "ATOMIMG";
+
+    public:
+        /// Count of memory units before the first object.
+        static constexpr sizet HeaderSize = AlignUp(sizeof(Header), 64);
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Constructs an empty image, to Load() into.
+        ArenaImage() noexcept { }
+
+        /// Reserves address space for the image, pages are backed by memory only when touched.
+        ///
+        /// @param reserveSize Count of memory units of address space to reserve.
+        ArenaImage(sizet reserveSize) noexcept
+        {
+            sizet size = AlignUp(HeaderSize + reserveSize, GetPageSize());
+            memptr mem = ReserveVirtualMemory(size, GetPageSize());
+            if (mem == nullptr) return;
+
+            if (CommitVirtualMemory(mem, size, false) != true)
+            {
+                ReleaseVirtualMemory(mem, size);
+                return;
+            }
+
+            _image = mem;
+            _imageSize = size;
+            _mem = mem + HeaderSize;
+            _size = size - HeaderSize;
+        }
+
+        ArenaImage(const ArenaImage& other) = delete;
+        ArenaImage& operator = (const ArenaImage& other) = delete;
+
+        ~ArenaImage()
+        {
+            _Release();
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Is the image mapped from a file?
+        bool IsMapped() const noexcept
+        {
+            return _isMapped;
+        }
+
+        /// Sets the object which Load() returns through GetRoot().
+        ///
+        /// @param root Object allocated from this image, or nullptr.
+        template <typename TypeT>
+        void SetRoot(TypeT* root) noexcept
+        {
+            DEBUG_ASSERT(root == nullptr or (RCAST(memptr, root) >= _mem
+                and RCAST(memptr, root) < _mem + _offset), "ArenaImage: root == not in the image.");
+
+            _rootOffset = root != nullptr ? RCAST(memptr, root) - _mem : NPOS;
+        }
+
+        /// Object set by SetRoot(), nullptr if not set.
+        template <typename TypeT>
+        TypeT* GetRoot() const noexcept
+        {
+            return _rootOffset != NPOS ? RCAST(TypeT*, _mem + _rootOffset) : nullptr;
+        }
+
+        /// Writes the header and all allocated objects to the file at \p{path}.
+        ///
+        /// @return true if successful.
+        bool Save(const char* path) const noexcept
+        {
+            if (_image == nullptr) return false;
+
+            FILE* file = fopen(path, "wb");
+            if (file == nullptr) return false;
+
+            alignas(Header) byte header[HeaderSize] = { };
+            Header* info = RCAST(Header*, header);
+            std::memcpy(info->magic, Magic, sizeof(Magic));
+            info->size = _offset;
+            info->rootOffset = _rootOffset;
+
+            bool isWritten = fwrite(header, 1, HeaderSize, file) == HeaderSize
+                and fwrite(_mem, 1, _offset, file) == _offset;
+
+            return fclose(file) == 0 and isWritten;
+        }
+
+        /// Releases current objects, and maps the image saved at \p{path}.
+        ///
+        /// @return true if successful, false if the file cannot be mapped or == not an image.
+        bool Load(const char* path) noexcept
+        {
+            _Release();
+
+            sizet fileSize;
+            memptr mem = MapFile(path, fileSize);
+            if (mem == nullptr) return false;
+
+            Header* info = RCAST(Header*, mem);
+            if (fileSize < HeaderSize or std::memcmp(info->magic, Magic, sizeof(Magic)) != 0
+                or info->size > fileSize - HeaderSize
+                or (info->rootOffset != NPOS and info->rootOffset >= info->size))
+            {
+                UnmapFile(mem, fileSize);
+                return false;
+            }
+
+            _image = mem;
+            _imageSize = fileSize;
+            _isMapped = true;
+            _mem = mem + HeaderSize;
+            _size = info->size;
+            _offset = info->size;
+            _rootOffset = info->rootOffset;
+            return true;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        void _Release() noexcept
+        {
+            if (_image != nullptr)
+            {
+                if (_isMapped)
+                {
+                    UnmapFile(_image, _imageSize);
+                }
+                else
+                {
+                    ReleaseVirtualMemory(_image, _imageSize);
+                }
+            }
+
+            _image = nullptr;
+            _imageSize = 0;
+            _isMapped = false;
+            _rootOffset = NPOS;
+            _mem = nullptr;
+            _size = 0;
+            Reset();
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Start of the image, the header lives here.
+        memptr _image = nullptr;
+        sizet _imageSize = 0;
+        bool _isMapped = false;
+        sizet _rootOffset = NPOS;
+    };
+}
\ No newline at end of file
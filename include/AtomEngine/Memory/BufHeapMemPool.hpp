@@ -4,10 +4,10 @@
 
 namespace Atom
 {
-    template<sizet StackSize, sizet BlockStackSize = 10>
-    class BufHeapMemPool: public HeapMemPool<BlockStackSize>
+    template<sizet StackSize>
+    class BufHeapMemPool: public HeapMemPool
     {
-        using BaseT = HeapMemPool<BlockStackSize>;
+        using BaseT = HeapMemPool;
 
     /// ----------------------------------------------------------------------------
     public:
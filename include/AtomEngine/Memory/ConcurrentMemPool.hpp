@@ -0,0 +1,380 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IDynamicMemPool.hpp"
+#include "AtomEngine/Memory/VirtualMemPool.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+
+namespace Atom
+{
+    /// ConcurrentMemPool == a thread safe pool, shared by many threads without a global lock.
+    ///
+    /// Memory == split into arenas, each a VirtualMemPool with its own lock, placed in
+    /// consecutive slices of a single reserved range. Each thread prefers one arena, and moves
+    /// on to the next arena which == not locked, so threads rarely wait on each other.
+    /// Memory == deallocated to the arena it came from, found from its address in constant time.
+    ///
+    /// @note Arenas grow independently, each up to its slice of the reserved range.
+    class ConcurrentMemPool: public virtual IDynamicMemPool
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Arenas are aligned to this, so their locks never share a cache line.
+        static constexpr sizet CacheLineSize = 64;
+
+        /// Max count of arenas.
+        static constexpr sizet MaxArenaCount = 64;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        struct alignas(CacheLineSize) Arena
+        {
+            Arena(memptr mem, sizet reserveSize, sizet size) noexcept:
+                pool(mem, reserveSize, size) { }
+
+            std::mutex lock;
+            VirtualMemPool pool;
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param arenaReserveSize Count of memory units of address space reserved for each arena,
+        ///     an arena never grows beyond this.
+        /// @param arenaCount Count of arenas, 0 to use twice the count of hardware threads.
+        /// @param size Count of memory units to commit initially, split between arenas.
+        ConcurrentMemPool(sizet arenaReserveSize, sizet arenaCount = 0, sizet size = 0) noexcept
+        {
+            if (arenaCount == 0)
+            {
+                arenaCount = 2 * max<sizet>(std::thread::hardware_concurrency(), 1);
+            }
+
+            arenaCount = min(arenaCount, MaxArenaCount);
+            arenaReserveSize = AlignUp(max<sizet>(arenaReserveSize, 1), GetPageSize());
+            if (arenaReserveSize > NPOS / arenaCount) return;
+
+            _mem = ReserveVirtualMemory(arenaReserveSize * arenaCount, GetPageSize());
+            if (_mem == nullptr) return;
+
+            _arenas = DefaultAllocatorInstance.Allocate<Arena>(arenaCount);
+            if (_arenas == nullptr)
+            {
+                ReleaseVirtualMemory(_mem, arenaReserveSize * arenaCount);
+                _mem = nullptr;
+                return;
+            }
+
+            _arenaReserveSize = arenaReserveSize;
+            _arenaCount = arenaCount;
+            for (sizet i = 0; i < _arenaCount; i++)
+            {
+                new(_arenas + i) Arena(_mem + i * _arenaReserveSize, _arenaReserveSize,
+                    size / _arenaCount);
+            }
+        }
+
+        ConcurrentMemPool(const ConcurrentMemPool& other) = delete;
+        ConcurrentMemPool& operator = (const ConcurrentMemPool& other) = delete;
+
+        ~ConcurrentMemPool()
+        {
+            if (_arenas != nullptr)
+            {
+                DefaultAllocatorInstance.Destruct(_arenas, _arenaCount);
+                ReleaseVirtualMemory(_mem, _arenaReserveSize * _arenaCount);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        sizet Size() const noexcept override final
+        {
+            return _Sum([](const VirtualMemPool& pool) { return pool.Size(); });
+        }
+
+        /// Count of memory units in use, in all arenas.
+        sizet UsedCount() const noexcept
+        {
+            return _Sum([](const VirtualMemPool& pool) { return pool.UsedCount(); });
+        }
+
+        /// Count of memory units available, in all arenas.
+        ///
+        /// @note A single allocation can only use memory of one arena.
+        sizet FreeCount() const noexcept
+        {
+            return _Sum([](const VirtualMemPool& pool) { return pool.FreeCount(); });
+        }
+
+        /// Count of arenas.
+        sizet ArenaCount() const noexcept
+        {
+            return _arenaCount;
+        }
+
+        /// Statistics of all arenas combined.
+        ///
+        /// @note Peak usage == the sum of peaks of arenas, which may not have happened at once.
+        MemPoolStats Stats() const noexcept override
+        {
+            MemPoolStats stats;
+            for (sizet i = 0; i < _arenaCount; i++)
+            {
+                MemPoolStats arenaStats;
+                {
+                    std::lock_guard<std::mutex> guard(_arenas[i].lock);
+                    arenaStats = _arenas[i].pool.Stats();
+                }
+
+                stats.size += arenaStats.size;
+                stats.usedCount += arenaStats.usedCount;
+                stats.peakUsedCount += arenaStats.peakUsedCount;
+                stats.allocCount += arenaStats.allocCount;
+                stats.deallocCount += arenaStats.deallocCount;
+                stats.reallocCount += arenaStats.reallocCount;
+                stats.allocBytes += arenaStats.allocBytes;
+                stats.deallocBytes += arenaStats.deallocBytes;
+                stats.freeBlockCount += arenaStats.freeBlockCount;
+                stats.largestFreeBlock = max(stats.largestFreeBlock, arenaStats.largestFreeBlock);
+
+                for (sizet j = 0; j < MemPoolStats::HistogramCount; j++)
+                {
+                    stats.histogram[j] += arenaStats.histogram[j];
+                }
+            }
+
+            return stats;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            memptr mem = nullptr;
+            _AllocateInArena([&](VirtualMemPool& pool)
+            {
+                mem = pool.AllocateRaw(size, clear, align);
+                return mem != nullptr;
+            });
+
+            return mem;
+        }
+
+        /// Allocates the whole batch from a single arena, locking it once.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (count == 0) return true;
+
+            bool isAllocated = _AllocateInArena([&](VirtualMemPool& pool)
+            {
+                return pool.AllocateBatch(size, count, outPtrs, clear, align);
+            });
+
+            // blocks of the batch may still fit in several arenas
+            if (isAllocated != true)
+            {
+                return IAllocator::AllocateBatch(size, count, outPtrs, clear, align);
+            }
+
+            return true;
+        }
+
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            if (size == 0)
+            {
+                DeallocateRaw(mem, 0);
+                return nullptr;
+            }
+
+            sizet oldSize;
+            {
+                Arena& arena = _FindArena(mem);
+                std::lock_guard<std::mutex> guard(arena.lock);
+
+                memptr newMem = arena.pool.ReallocateRaw(mem, size, clear, clearAll, align);
+                if (newMem != nullptr) return newMem;
+
+                oldSize = arena.pool.GetBlockSize(mem);
+            }
+
+            // arena of the memory == full, move it to another arena
+            memptr newMem = AllocateRaw(size, clear, align);
+            if (newMem == nullptr) return nullptr;
+
+            if (clear != true or clearAll != true)
+            {
+                memcpy(newMem, mem, min(oldSize, size));
+            }
+
+            DeallocateRaw(mem, oldSize);
+            return newMem;
+        }
+
+        void DeallocateRaw(memptr mem, sizet size) override final
+        {
+            if (mem == nullptr) return;
+
+            Arena& arena = _FindArena(mem);
+            std::lock_guard<std::mutex> guard(arena.lock);
+            arena.pool.DeallocateRaw(mem, size);
+        }
+
+        /// Locks the arena once for each run of blocks from the same arena.
+        void DeallocateBatch(memptr* ptrs, sizet count, sizet size = 0) override final
+        {
+            sizet i = 0;
+            while (i < count)
+            {
+                if (ptrs[i] == nullptr)
+                {
+                    i++;
+                    continue;
+                }
+
+                Arena& arena = _FindArena(ptrs[i]);
+                sizet end = i + 1;
+                while (end < count and (ptrs[end] == nullptr or &_FindArena(ptrs[end]) == &arena))
+                {
+                    end++;
+                }
+
+                std::lock_guard<std::mutex> guard(arena.lock);
+                arena.pool.DeallocateBatch(ptrs + i, end - i, size);
+                i = end;
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Shrinks every arena, locking one at a time.
+        void Shrink() override final
+        {
+            for (sizet i = 0; i < _arenaCount; i++)
+            {
+                std::lock_guard<std::mutex> guard(_arenas[i].lock);
+                _arenas[i].pool.Shrink();
+            }
+        }
+
+        /// @note Memory == reserved in the arena preferred by the calling thread.
+        void Reserve(sizet size) override final
+        {
+            sizet freeCount = FreeCount();
+            if (size > freeCount)
+            {
+                ReserveMore(size - freeCount);
+            }
+        }
+
+        /// @note Memory == reserved in the arena preferred by the calling thread.
+        void ReserveMore(sizet size) override final
+        {
+            if (_arenaCount == 0) return;
+
+            sizet threadArena = _threadArena != NPOS ? _threadArena : 0;
+            Arena& arena = _arenas[threadArena % _arenaCount];
+
+            std::lock_guard<std::mutex> guard(arena.lock);
+            arena.pool.ReserveMore(size);
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Calls \p{allocate} with the pool of each arena under its lock, until it succeeds.
+        /// Starts at the arena preferred by the current thread, first skipping locked arenas,
+        /// then waiting for them.
+        ///
+        /// @return @true if \p{allocate} succeeded.
+        template <typename AllocateT>
+        bool _AllocateInArena(AllocateT&& allocate)
+        {
+            if (_arenaCount == 0) return false;
+
+            sizet& threadArena = _threadArena;
+            if (threadArena == NPOS)
+            {
+                threadArena = _nextThreadArena.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            for (sizet pass = 0; pass < 2; pass++)
+            {
+                for (sizet i = 0; i < _arenaCount; i++)
+                {
+                    sizet index = (threadArena + i) % _arenaCount;
+                    Arena& arena = _arenas[index];
+
+                    std::unique_lock<std::mutex> guard(arena.lock, std::defer_lock);
+                    if (pass == 0)
+                    {
+                        if (guard.try_lock() != true) continue;
+                    }
+                    else
+                    {
+                        guard.lock();
+                    }
+
+                    if (allocate(arena.pool))
+                    {
+                        // keep using the arena which was free
+                        threadArena = index;
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /// Arena which allocated \p{mem}.
+        Arena& _FindArena(memptr mem) const noexcept
+        {
+            sizet index = SCAST(sizet, mem - _mem) / _arenaReserveSize;
+            DEBUG_ASSERT(index < _arenaCount, "ConcurrentMemPool: \
+                memory not allocated from this pool.");
+
+            return _arenas[index];
+        }
+
+        /// Sums \p{get} of all arenas, locking one at a time.
+        template <typename GetT>
+        sizet _Sum(GetT&& get) const noexcept
+        {
+            sizet sum = 0;
+            for (sizet i = 0; i < _arenaCount; i++)
+            {
+                std::lock_guard<std::mutex> guard(_arenas[i].lock);
+                sum += get(_arenas[i].pool);
+            }
+
+            return sum;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Range reserved for all arenas.
+        memptr _mem = nullptr;
+        sizet _arenaReserveSize = 0;
+        Arena* _arenas = nullptr;
+        sizet _arenaCount = 0;
+
+        /// Arena preferred by the current thread, NPOS until its first allocation.
+        static thread_local sizet _threadArena;
+
+        /// Spreads threads over arenas.
+        static std::atomic<sizet> _nextThreadArena;
+    };
+
+    inline thread_local sizet ConcurrentMemPool::_threadArena = NPOS;
+    inline std::atomic<sizet> ConcurrentMemPool::_nextThreadArena{ 0 };
+}
\ No newline at end of file
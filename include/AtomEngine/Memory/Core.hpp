@@ -18,6 +18,23 @@ namespace Atom
     /// memptr == used to refer to a memory block.
     using memptr = memt *;
 
+    /// Alignment of memory returned by allocators, when no alignment == requested.
+    /// 
+    /// Memory aligned to DefaultAlign == suitably aligned for any scalar type.
+    constexpr sizet DefaultAlign = alignof(std::max_align_t);
+
+    /// Checks if \p{align} == a valid alignment, a power of 2.
+    constexpr bool IsValidAlign(sizet align) noexcept
+    {
+        return align != 0 and (align & (align - 1)) == 0;
+    }
+
+    /// Checks if \p{mem} == aligned to \p{align}.
+    inline bool IsAligned(const void* mem, sizet align) noexcept
+    {
+        return (RCAST(sizet, mem) & (align - 1)) == 0;
+    }
+
     /// Function to copy memory from one place to another.
     /// 
     /// @param dest Ptr to the destination to copy.
@@ -28,6 +45,16 @@ namespace Atom
         std::memcpy(dest, src, size);
     }
 
+    /// Function to copy memory from one place to another, the places may overlap.
+    /// 
+    /// @param dest Ptr to the destination to copy.
+    /// @param src Ptr to the source to copy.
+    /// @param size Count of memory units to copy.
+    inline void memmove(memptr dest, memptr src, sizet size) noexcept
+    {
+        std::memmove(RCAST(void*, dest), RCAST(const void*, src), size);
+    }
+
     /// Writes \p{value} at specified memory.
     /// 
     /// @param dest Ptr to the memory.
@@ -37,4 +64,31 @@ namespace Atom
     {
         std::memset(dest, value, count);
     }
+
+    /// Rounds \p{value} up to the next multiple of \p{align}.
+    /// 
+    /// @param value Value to round.
+    /// @param align Alignment to round to, must be a power of 2.
+    constexpr sizet AlignUp(sizet value, sizet align) noexcept
+    {
+        return (value + align - 1) & ~(align - 1);
+    }
+
+    /// Rounds \p{value} down to the previous multiple of \p{align}.
+    /// 
+    /// @param value Value to round.
+    /// @param align Alignment to round to, must be a power of 2.
+    constexpr sizet AlignDown(sizet value, sizet align) noexcept
+    {
+        return value & ~(align - 1);
+    }
+
+    /// Rounds \p{mem} up to the next address aligned to \p{align}.
+    /// 
+    /// @param mem Address to round.
+    /// @param align Alignment to round to, must be a power of 2.
+    inline memptr AlignUp(memptr mem, sizet align) noexcept
+    {
+        return RCAST(memptr, AlignUp(RCAST(sizet, mem), align));
+    }
 }
\ No newline at end of file
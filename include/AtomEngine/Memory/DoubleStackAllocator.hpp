@@ -0,0 +1,320 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IMemPool.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+
+namespace Atom
+{
+    /// DoubleStackAllocator == a stack allocator growing from both ends of one region.
+    /// 
+    /// The lower stack grows up from the start of the region, and == used through
+    /// the IAllocator functions. The upper stack grows down from the end of the region,
+    /// and == used through Upper(). Both stacks share the free memory in between,
+    /// which suits data with two different lifetimes, like level data and per load
+    /// temporary data.
+    /// 
+    /// @note Every allocation == preceded by a header of \p{BlockHeaderSize} storing its size.
+    class DoubleStackAllocator: public virtual IMemPool
+    {
+    public:
+        /// Alignment of every allocation.
+        static constexpr sizet Align = alignof(std::max_align_t);
+
+        /// Count of memory units used by the header in front of an allocation,
+        /// when allocating with alignment of at most \p{Align}.
+        static constexpr sizet BlockHeaderSize = AlignUp(2 * sizeof(sizet), Align);
+
+        /// Saved top of one of the stacks.
+        using Marker = sizet;
+
+        /// IAllocator allocating from the upper stack.
+        class UpperStack: public virtual IAllocator
+        {
+        public:
+            UpperStack(DoubleStackAllocator& owner) noexcept:
+                _owner(&owner) { }
+
+        public:
+            memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+            {
+                return _owner->_AllocateUpper(size, clear, align);
+            }
+
+            memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+                bool clearAll = false, sizet align = DefaultAlign) override final
+            {
+                return _owner->_ReallocateUpper(mem, size, clear, clearAll, align);
+            }
+
+            /// Frees \p{mem} if it == the last allocation of the upper stack.
+            void DeallocateRaw(memptr mem, sizet size) override final
+            {
+                if (mem != nullptr and mem == _owner->_upperLast)
+                {
+                    _owner->FreeToUpperMarker(_GetHeader(mem)->offset);
+                }
+            }
+
+        protected:
+            DoubleStackAllocator* _owner;
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Uses memory owned by the caller.
+        /// 
+        /// @param mem Ptr to the memory region, must be aligned to \p{Align}.
+        /// @param size Count of memory units in the region.
+        DoubleStackAllocator(memptr mem, sizet size) noexcept:
+            _mem(mem), _size(AlignDown(size, Align)), _upper(_size) { }
+
+        /// Allocates the memory region from \p{allocator}, and releases it on destruction.
+        /// 
+        /// @param size Count of memory units in the region.
+        /// @param allocator Allocator used to allocate the region.
+        DoubleStackAllocator(sizet size, IAllocator& allocator = DefaultAllocatorInstance) noexcept:
+            _allocator(&allocator)
+        {
+            _mem = allocator.AllocateRaw(size, false);
+            _size = _mem != nullptr ? AlignDown(size, Align) : 0;
+            _upper = _size;
+        }
+
+        DoubleStackAllocator(const DoubleStackAllocator& other) = delete;
+        DoubleStackAllocator& operator = (const DoubleStackAllocator& other) = delete;
+
+        ~DoubleStackAllocator()
+        {
+            if (_allocator != nullptr and _mem != nullptr)
+            {
+                _allocator->DeallocateRaw(_mem, _size);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        sizet Size() const noexcept override final
+        {
+            return _size;
+        }
+
+        /// Count of memory units available to allocate from either stack,
+        /// excluding the header of the allocation.
+        sizet FreeCount() const noexcept
+        {
+            sizet freeCount = _upper - _lower;
+            return freeCount > BlockHeaderSize ? freeCount - BlockHeaderSize : 0;
+        }
+
+        /// IAllocator allocating from the upper stack.
+        UpperStack& Upper() noexcept
+        {
+            return _upperStack;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        Marker GetLowerMarker() const noexcept
+        {
+            return _lower;
+        }
+
+        Marker GetUpperMarker() const noexcept
+        {
+            return _upper;
+        }
+
+        /// Frees all memory allocated from the lower stack after \p{marker} was taken.
+        void FreeToLowerMarker(Marker marker) noexcept
+        {
+            DEBUG_ASSERT(marker <= _lower, "DoubleStackAllocator: marker == above the lower stack.");
+
+            _lower = marker;
+            _lowerLast = nullptr;
+        }
+
+        /// Frees all memory allocated from the upper stack after \p{marker} was taken.
+        void FreeToUpperMarker(Marker marker) noexcept
+        {
+            DEBUG_ASSERT(marker >= _upper and marker <= _size,
+                "DoubleStackAllocator: marker == below the upper stack.");
+
+            _upper = marker;
+            _upperLast = nullptr;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (size == 0 or size > FreeCount()) return nullptr;
+
+            sizet alignedSize = AlignUp(size, Align);
+            memptr mem = AlignUp(_mem + _lower + sizeof(_BlockHeader), max(align, Align));
+            sizet offset = mem - _mem;
+            if (offset > _upper or alignedSize > _upper - offset) return nullptr;
+
+            *_GetHeader(mem) = { _lower, size };
+            _lower = offset + alignedSize;
+            _lowerLast = mem;
+
+            if (clear)
+            {
+                memset(mem, 0, alignedSize);
+            }
+
+            return mem;
+        }
+
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            _BlockHeader* header = _GetHeader(mem);
+            sizet oldSize = header->size;
+            bool isAligned = IsAligned(mem, align);
+            if (isAligned and mem == _lowerLast)
+            {
+                sizet offset = mem - _mem;
+                if (size > _upper - offset) return nullptr;
+
+                _lower = offset + AlignUp(size, Align);
+                header->size = size;
+
+                if (clear)
+                {
+                    sizet clearOffset = clearAll ? 0 : min(oldSize, size);
+                    memset(mem + clearOffset, 0, size - clearOffset);
+                }
+
+                return mem;
+            }
+
+            // other allocations can only shrink in place,
+            // growing them in place would overwrite the allocations after them
+            if (isAligned and size <= oldSize)
+            {
+                return _ShrinkMemory(mem, size, clear, clearAll);
+            }
+
+            return _MoveMemory(AllocateRaw(size, false, align), mem, oldSize, size, clear, clearAll);
+        }
+
+        /// Frees \p{mem} if it == the last allocation of the lower stack.
+        void DeallocateRaw(memptr mem, sizet size) override final
+        {
+            if (mem != nullptr and mem == _lowerLast)
+            {
+                FreeToLowerMarker(_GetHeader(mem)->offset);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        memptr _AllocateUpper(sizet size, bool clear, sizet align)
+        {
+            if (size == 0 or size > FreeCount()) return nullptr;
+
+            sizet alignedSize = AlignUp(size, Align);
+            sizet top = RCAST(sizet, _mem + _upper) - alignedSize;
+            memptr mem = RCAST(memptr, AlignDown(top, max(align, Align)));
+            if (mem < _mem + _lower + BlockHeaderSize) return nullptr;
+
+            sizet oldUpper = _upper;
+            _upper = mem - _mem - BlockHeaderSize;
+            _upperLast = mem;
+            *_GetHeader(mem) = { oldUpper, size };
+
+            if (clear)
+            {
+                memset(mem, 0, _mem + oldUpper - mem);
+            }
+
+            return mem;
+        }
+
+        /// The upper stack grows down, so memory == resized in place only when shrinking.
+        memptr _ReallocateUpper(memptr mem, sizet size, bool clear, bool clearAll, sizet align)
+        {
+            if (mem == nullptr)
+            {
+                return _AllocateUpper(size, clear, align);
+            }
+
+            sizet oldSize = _GetHeader(mem)->size;
+            if (IsAligned(mem, align) and size <= oldSize)
+            {
+                return _ShrinkMemory(mem, size, clear, clearAll);
+            }
+
+            return _MoveMemory(_AllocateUpper(size, false, align), mem, oldSize, size, clear, clearAll);
+        }
+
+        static memptr _ShrinkMemory(memptr mem, sizet size, bool clear, bool clearAll) noexcept
+        {
+            _GetHeader(mem)->size = size;
+            if (clear and clearAll)
+            {
+                memset(mem, 0, size);
+            }
+
+            return mem;
+        }
+
+        static memptr _MoveMemory(memptr newMem, memptr mem, sizet oldSize, sizet size,
+            bool clear, bool clearAll) noexcept
+        {
+            if (newMem == nullptr)
+            {
+                return nullptr;
+            }
+
+            sizet copySize = min(oldSize, size);
+            memcpy(newMem, mem, copySize);
+            if (clear)
+            {
+                sizet offset = clearAll ? 0 : copySize;
+                memset(newMem + offset, 0, size - offset);
+            }
+
+            return newMem;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Stored in front of every allocation.
+        struct _BlockHeader
+        {
+            /// Top of the stack before the allocation.
+            sizet offset;
+
+            /// Size requested for the allocation.
+            sizet size;
+        };
+
+        static _BlockHeader* _GetHeader(memptr mem) noexcept
+        {
+            return RCAST(_BlockHeader*, mem - sizeof(_BlockHeader));
+        }
+
+        /// Allocator owning the memory region, nullptr if owned by the caller.
+        IAllocator* _allocator = nullptr;
+        memptr _mem = nullptr;
+        sizet _size = 0;
+
+        /// Offset of the top of lower stack.
+        sizet _lower = 0;
+
+        /// Offset of the top of upper stack.
+        sizet _upper = 0;
+
+        memptr _lowerLast = nullptr;
+        memptr _upperLast = nullptr;
+
+        UpperStack _upperStack = UpperStack(*this);
+    };
+}
\ No newline at end of file
@@ -11,9 +11,56 @@ namespace Atom
     {
     /// ----------------------------------------------------------------------------
     public:
-        void Shrink() override final
+        /// Returns chunks allocated by the pool, which are entirely free, back to the system.
+        /// Does nothing until free memory exceeds the release threshold, and keeps at least
+        /// the retain count of free memory, so allocation bursts do not grow and shrink
+        /// the pool repeatedly.
+        /// 
+        /// @note Cheap when there == nothing to release, can be called from a timer or an idle hook.
+        /// @see SetShrinkHysteresis(sizet releaseAbove, sizet retain)
+        void Shrink() override
         {
-            // TODO: implement
+            if (FreeCount() <= _shrinkThreshold) return;
+
+            Chunk* next = nullptr;
+            for (Chunk* chunk = _rootChunk; chunk != nullptr; chunk = next)
+            {
+                next = chunk->next;
+                if (chunk->isOwned != true or chunk->IsFree() != true) continue;
+                if (_CanDeallocateMemory(chunk->mem, chunk->size) != true) continue;
+
+                sizet chunkFree = chunk->RootBlock()->Size();
+                if (FreeCount() - chunkFree < _shrinkRetain) continue;
+
+                memptr mem = chunk->mem;
+                sizet size = chunk->size;
+                if (_TryRemoveMemory(mem, size) != 0)
+                {
+                    _DeallocateMemory(mem, size);
+                }
+            }
+        }
+
+        /// Sets hysteresis used by Shrink().
+        /// 
+        /// @param[in] releaseAbove Shrink() releases memory only if free memory exceeds this.
+        /// @param[in] retain Free memory to keep in the pool after Shrink().
+        void SetShrinkHysteresis(sizet releaseAbove, sizet retain) noexcept
+        {
+            _shrinkThreshold = releaseAbove;
+            _shrinkRetain = retain;
+        }
+
+        /// Free memory above which Shrink() releases memory.
+        sizet ShrinkThreshold() const noexcept
+        {
+            return _shrinkThreshold;
+        }
+
+        /// Free memory kept in the pool by Shrink().
+        sizet ShrinkRetain() const noexcept
+        {
+            return _shrinkRetain;
         }
 
         void Reserve(sizet size) override final
@@ -27,40 +74,86 @@ namespace Atom
 
         void ReserveMore(sizet size) override final
         {
-            memptr mem = _AllocateMemory(size);
-            if (mem == nullptr)
+            if (_AddMemory(size) == nullptr)
             {
                 // todo: throw exception
                 // out of memory
 
                 return;
             }
-
-            blockptr block = mCreateBlock();
-            block->mem = mem;
-            block->size = size;
-            block->isFree = true;
-            block->isRoot = true;
-            block->next = nullptr;
         }
 
     /// ----------------------------------------------------------------------------
     protected:
-        /// @note Calls _AllocateMemory, and passes it to _AddMemory(mem, size, isRoot);
-        blockptr _AddMemory(sizet size, bool isRoot = true)
+        using LinkedMemPool::_AddMemory;
+
+        /// Adds enough memory to allocate \p{size} memory units,
+        /// doubling the pool size to keep expansions rare.
+        /// Falls back to adding just enough, as bounded backends may have room left
+        /// for that but not for doubling.
+        bool _TryExpand(sizet size) override
+        {
+            size = _RoundToSizeClass(size);
+            if (size == 0) return false;
+
+            if (Size() > size and _AddMemory(Size()) != nullptr) return true;
+
+            return _AddMemory(size) != nullptr;
+        }
+
+        /// Adds memory with at least \p{size} usable memory units.
+        ///
+        /// @note Calls _AllocateMemory, and passes it to _AddMemory(mem, size);
+        blockptr _AddMemory(sizet size)
         {
             if (size == 0) return nullptr;
+            if (size > NPOS - ChunkOverhead - BlockAlign) return nullptr;
 
+            size = _RoundChunkSize(AlignUp(size, BlockAlign) + ChunkOverhead);
             memptr mem = _AllocateMemory(size);
             if (mem == nullptr)
             {
                 return nullptr;
             }
 
-            return LinkedMemPool::_AddMemory(mem, size, isRoot);
+            blockptr block = LinkedMemPool::_AddMemory(mem, size, _IsAllocatedMemoryZero());
+            if (block == nullptr)
+            {
+                _DeallocateMemory(mem, size);
+                return nullptr;
+            }
+
+            _rootChunk->isOwned = true;
+            return block;
+        }
+
+        /// Rounds size of memory to allocate for a new chunk,
+        /// so that memory lost to the granularity of _AllocateMemory() == used by the pool.
+        virtual sizet _RoundChunkSize(sizet size) const noexcept
+        {
+            return size;
+        }
+
+        /// Does memory returned by _AllocateMemory() read 0?
+        /// If so, allocations from it skip clearing.
+        virtual bool _IsAllocatedMemoryZero() const noexcept
+        {
+            return false;
+        }
+
+        /// Can Shrink() return the chunk at \p{mem} to the backend?
+        /// Backends which reuse returned memory only in some order restrict this.
+        virtual bool _CanDeallocateMemory(memptr mem, sizet size) const noexcept
+        {
+            return true;
         }
 
         virtual memptr _AllocateMemory(sizet count) = 0;
         virtual void _DeallocateMemory(memptr mem, sizet count) = 0;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        sizet _shrinkThreshold = 0;
+        sizet _shrinkRetain = 0;
     };
 }
\ No newline at end of file
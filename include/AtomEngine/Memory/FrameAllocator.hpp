@@ -0,0 +1,81 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+
+namespace Atom
+{
+    /// FrameAllocator cycles through \p{BufferCount} LinearAllocator objects, one per frame.
+    /// 
+    /// Memory allocated during a frame stays valid for the next \p{BufferCount} - 1 frames,
+    /// so data of frame N can still be read while frame N + 1 == being built.
+    /// 
+    /// @tparam BufferCount Count of frames whose memory == kept alive, 2 for double buffering.
+    template <sizet BufferCount = 2>
+    class FrameAllocator: public virtual IMemPool
+    {
+        SASSERT(BufferCount > 0, "FrameAllocator: BufferCount == 0.");
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param frameSize Count of memory units available to each frame.
+        /// @param allocator Allocator used to allocate memory of each frame.
+        FrameAllocator(sizet frameSize, IAllocator& allocator = DefaultAllocatorInstance) noexcept
+        {
+            for (LinearAllocator& buffer : _buffers)
+            {
+                buffer = LinearAllocator(frameSize, allocator);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Starts a new frame, frees memory allocated \p{BufferCount} frames ago.
+        void NextFrame() noexcept
+        {
+            _current = (_current + 1) % BufferCount;
+            _buffers[_current].Reset();
+        }
+
+        /// LinearAllocator of the current frame.
+        LinearAllocator& Current() noexcept
+        {
+            return _buffers[_current];
+        }
+
+        /// LinearAllocator of the frame \p{age} frames before the current one.
+        /// 
+        /// @param age Must be less than \p{BufferCount}.
+        LinearAllocator& Previous(sizet age = 1) noexcept
+        {
+            return _buffers[(_current + BufferCount - age % BufferCount) % BufferCount];
+        }
+
+        /// Count of memory units available to each frame.
+        sizet Size() const noexcept override final
+        {
+            return _buffers[_current].Size();
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            return Current().AllocateRaw(size, clear, align);
+        }
+
+        /// @note \p{mem} must be allocated during the current frame.
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            return Current().ReallocateRaw(mem, size, clear, clearAll, align);
+        }
+
+        /// Does nothing, memory == freed when its frame buffer == reused.
+        void DeallocateRaw(memptr mem, sizet size) override final { }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        LinearAllocator _buffers[BufferCount];
+        sizet _current = 0;
+    };
+}
\ No newline at end of file
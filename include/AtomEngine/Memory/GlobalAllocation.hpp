@@ -27,6 +27,12 @@ namespace Atom
         return globalAllocator->ConstructMultiple<T>(count, forward<ArgsT>(args)...);
     }
 
+    template <typename T, typename... ArgsT>
+    inline bool createBatch(T** outObjs, sizet count, ArgsT... args)
+    {
+        return globalAllocator->ConstructBatch<T>(outObjs, count, forward<ArgsT>(args)...);
+    }
+
     template <typename T>
     inline void destroy(T* obj)
     {
@@ -38,4 +44,10 @@ namespace Atom
     {
         globalAllocator->Destruct<T>(obj, count);
     }
+
+    template <typename T>
+    inline void destroyBatch(T** objs, sizet count)
+    {
+        globalAllocator->DestructBatch<T>(objs, count);
+    }
 }
\ No newline at end of file
@@ -9,14 +9,15 @@ namespace Atom
         public virtual IAllocator
     {
     public:
-        memptr AllocateRaw(sizet count, bool clear = true) override final
+        memptr AllocateRaw(sizet count, bool clear = true, sizet align = DefaultAlign) override final
         {
-            return globalAllocator->AllocateRaw(count, clear);
+            return globalAllocator->AllocateRaw(count, clear, align);
         }
 
-        memptr ReallocateRaw(const memptr mem, sizet count, bool clear = true, bool clearAll = false) override final
+        memptr ReallocateRaw(const memptr mem, sizet count, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
         {
-            return globalAllocator->ReallocateRaw(mem, count, clear, clearAll);
+            return globalAllocator->ReallocateRaw(mem, count, clear, clearAll, align);
         }
 
         void DeallocateRaw(const memptr mem, sizet count) override final
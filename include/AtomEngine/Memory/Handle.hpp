@@ -0,0 +1,36 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+
+namespace Atom
+{
+    /// Reference to an object, which stays valid when the object moves.
+    ///
+    /// A handle == an index into a table of its owner, like HandleMemPool or SlotMap, and the
+    /// generation of that table entry, so a handle to a destroyed object never refers
+    /// to a newer object.
+    ///
+    /// @tparam TypeT Type of object referenced by the handle, void for raw memory.
+    template <typename TypeT = void>
+    struct THandle
+    {
+        uint index = 0;
+
+        /// Generation of the table entry, 0 for null handle.
+        uint generation = 0;
+
+        bool IsNull() const noexcept
+        {
+            return generation == 0;
+        }
+
+        bool operator == (const THandle& other) const noexcept
+        {
+            return index == other.index and generation == other.generation;
+        }
+
+        bool operator != (const THandle& other) const noexcept
+        {
+            return not (*this == other);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+#pragma once
+#include <chrono>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/Handle.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+
+namespace Atom
+{
+    /// HandleMemPool manages memory blocks referenced by handles, which lets it move
+    /// blocks to close holes left by deallocations.
+    ///
+    /// Blocks are allocated at the top of a single memory region. Defragment() compacts the
+    /// region incrementally, each call moves live blocks down over holes within a budget,
+    /// and updates the handle table. So the pool can run with little free memory, as freed
+    /// memory returns to the top of the region instead of being left in holes.
+    /// When the top runs out of memory, the pool finishes compaction if holes can serve
+    /// the request, otherwise the region grows.
+    ///
+    /// @note
+    /// - Objects are moved with memmove, so they must not store ptrs into themselves.
+    /// - Ptrs returned by Get() are valid until the next AllocateRaw(), Construct() or
+    ///   Defragment() call.
+    class HandleMemPool
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Alignment of every memory block.
+        static constexpr sizet BlockAlign = alignof(std::max_align_t);
+
+        /// Count of memory units Defragment() moves between checks of the time budget.
+        static constexpr sizet DefragmentStepSize = 16 * 1024;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Header placed before each block in the region.
+        struct Block
+        {
+            /// Count of memory units after the header.
+            sizet size;
+
+            /// Index of the handle table entry of this block, NPOS if the block == free.
+            sizet index;
+        };
+
+        static constexpr sizet HeaderSize = AlignUp(sizeof(Block), BlockAlign);
+
+        /// Entry of the handle table.
+        struct Entry
+        {
+            /// Offset of the memory block in the region, NPOS if the entry == free.
+            sizet offset;
+
+            /// Next free entry if the entry == free.
+            uint nextFree;
+
+            uint generation;
+        };
+
+        static constexpr uint NullIndex = SCAST(uint, -1);
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param size Count of memory units of the region to allocate up front.
+        /// @param allocator Allocator used to allocate the region and the handle table.
+        HandleMemPool(sizet size = 0, IAllocator& allocator = DefaultAllocatorInstance) noexcept:
+            _allocator(&allocator)
+        {
+            if (size > 0)
+            {
+                _Grow(size);
+            }
+        }
+
+        HandleMemPool(const HandleMemPool& other) = delete;
+        HandleMemPool& operator = (const HandleMemPool& other) = delete;
+
+        ~HandleMemPool()
+        {
+            _allocator->DeallocateRaw(_mem, _size);
+            _allocator->DeallocateRaw(RCAST(memptr, _entries), _entryCount * sizeof(Entry));
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of memory units of the region.
+        sizet Size() const noexcept
+        {
+            return _size;
+        }
+
+        /// Count of memory units of live blocks, including their headers.
+        sizet UsedCount() const noexcept
+        {
+            return _top - _holeSize;
+        }
+
+        /// Count of memory units available, at the top and in holes.
+        sizet FreeCount() const noexcept
+        {
+            return _size - UsedCount();
+        }
+
+        /// Count of memory units in holes, which Defragment() moves to the top.
+        sizet HoleCount() const noexcept
+        {
+            return _holeSize;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Allocates memory and Constructs an object with given args.
+        ///
+        /// @return Handle to the object, null handle if out of memory.
+        template <typename TypeT, typename... ArgsT>
+        THandle<TypeT> Construct(ArgsT&&... args)
+        {
+            THandle<void> handle = AllocateRaw(sizeof(TypeT), false);
+            if (handle.IsNull()) return { };
+
+            new(GetRaw(handle)) TypeT(forward<ArgsT>(args)...);
+            return { handle.index, handle.generation };
+        }
+
+        /// Destructs the object and deallocates its memory, does nothing for stale handles.
+        template <typename TypeT>
+        void Destruct(THandle<TypeT> handle)
+        {
+            TypeT* obj = Get(handle);
+            if (obj == nullptr) return;
+
+            obj->TypeT::~TypeT();
+            DeallocateRaw(THandle<void>{ handle.index, handle.generation });
+        }
+
+        /// Ptr to the object, @nullptr for null or stale handles.
+        template <typename TypeT>
+        TypeT* Get(THandle<TypeT> handle) const noexcept
+        {
+            return RCAST(TypeT*, GetRaw(THandle<void>{ handle.index, handle.generation }));
+        }
+
+        /// Does the handle refer to a live block?
+        template <typename TypeT>
+        bool IsValid(THandle<TypeT> handle) const noexcept
+        {
+            return handle.index < _entryCount and handle.generation != 0
+                and _entries[handle.index].generation == handle.generation
+                and _entries[handle.index].offset != NPOS;
+        }
+
+        /// Allocates a block of \p{size} memory units.
+        ///
+        /// @param clear If true, initializes memory with 0.
+        /// @return Handle to the block, null handle if \p{size} == 0 or out of memory.
+        THandle<void> AllocateRaw(sizet size, bool clear = true)
+        {
+            if (size == 0 or size > NPOS / 2) return { };
+
+            size = AlignUp(size, BlockAlign);
+            sizet blockSize = HeaderSize + size;
+
+            if (blockSize > _size - _top)
+            {
+                // holes serve the request once moved to the top, else grow the region
+                if (blockSize <= _size - _top + _holeSize)
+                {
+                    Defragment(NPOS);
+                }
+                else if (_Grow(_top + blockSize) != true)
+                {
+                    return { };
+                }
+            }
+
+            uint index = _AcquireEntry();
+            if (index == NullIndex) return { };
+
+            Block* block = _GetBlock(_top);
+            block->size = size;
+            block->index = index;
+
+            Entry& entry = _entries[index];
+            entry.offset = _top + HeaderSize;
+            _top += blockSize;
+
+            if (clear)
+            {
+                memset(_mem + entry.offset, 0, size);
+            }
+
+            return { index, entry.generation };
+        }
+
+        /// Deallocates the block, does nothing for null or stale handles.
+        void DeallocateRaw(THandle<void> handle) noexcept
+        {
+            if (IsValid(handle) != true) return;
+
+            Entry& entry = _entries[handle.index];
+            sizet offset = entry.offset - HeaderSize;
+            Block* block = _GetBlock(offset);
+            sizet blockSize = HeaderSize + block->size;
+            block->index = NPOS;
+
+            entry.offset = NPOS;
+            entry.generation = entry.generation + 1 != 0 ? entry.generation + 1 : 1;
+            entry.nextFree = _freeEntry;
+            _freeEntry = handle.index;
+
+            if (offset + blockSize == _top and offset >= _compactCursor)
+            {
+                // the top block returns to the top directly
+                _top = offset;
+            }
+            else if (offset + blockSize == _top and _compactDest == _top)
+            {
+                // compaction passed the top block, and stays at the top
+                _top = offset;
+                _compactCursor = _top;
+                _compactDest = _top;
+            }
+            else
+            {
+                _holeSize += blockSize;
+            }
+        }
+
+        /// Ptr to the block, @nullptr for null or stale handles.
+        memptr GetRaw(THandle<void> handle) const noexcept
+        {
+            return IsValid(handle) ? _mem + _entries[handle.index].offset : nullptr;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Moves live blocks down over holes, until about \p{maxMoveSize} memory units
+        /// have been moved or no holes are left.
+        ///
+        /// Compaction continues where the last call stopped, the blocks between are not visited
+        /// again. Visiting a block counts as \p{HeaderSize} memory units of the budget.
+        ///
+        /// @return Count of memory units moved and visited.
+        sizet Defragment(sizet maxMoveSize)
+        {
+            sizet moveSize = 0;
+            while (moveSize < maxMoveSize)
+            {
+                if (_compactCursor == _top)
+                {
+                    // pass done, the gap at the end returns to the top
+                    _holeSize -= _top - _compactDest;
+                    _top = _compactDest;
+
+                    if (_holeSize == 0)
+                    {
+                        _compactCursor = _top;
+                        _compactDest = _top;
+                        break;
+                    }
+
+                    _compactCursor = 0;
+                    _compactDest = 0;
+                    continue;
+                }
+
+                Block* block = _GetBlock(_compactCursor);
+                sizet blockSize = HeaderSize + block->size;
+                if (block->index == NPOS)
+                {
+                    moveSize += HeaderSize;
+                }
+                else if (_compactDest != _compactCursor)
+                {
+                    memmove(_mem + _compactDest, _mem + _compactCursor, blockSize);
+                    _entries[_GetBlock(_compactDest)->index].offset = _compactDest + HeaderSize;
+
+                    _compactDest += blockSize;
+                    moveSize += blockSize;
+                }
+                else
+                {
+                    _compactDest += blockSize;
+                    moveSize += HeaderSize;
+                }
+
+                _compactCursor += blockSize;
+
+                // the memory between moved blocks and the cursor == a single free block
+                if (_compactDest != _compactCursor)
+                {
+                    Block* gap = _GetBlock(_compactDest);
+                    gap->size = _compactCursor - _compactDest - HeaderSize;
+                    gap->index = NPOS;
+                }
+            }
+
+            return moveSize;
+        }
+
+        /// Moves live blocks down over holes, until \p{budget} time has passed
+        /// or no holes are left. Meant to be called once per frame.
+        ///
+        /// @return Count of memory units moved and visited.
+        sizet Defragment(std::chrono::nanoseconds budget)
+        {
+            auto end = std::chrono::steady_clock::now() + budget;
+
+            sizet moveSize = 0;
+            while (_holeSize > 0)
+            {
+                moveSize += Defragment(DefragmentStepSize);
+                if (std::chrono::steady_clock::now() >= end) break;
+            }
+
+            return moveSize;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        Block* _GetBlock(sizet offset) const noexcept
+        {
+            return RCAST(Block*, _mem + offset);
+        }
+
+        /// Takes a free entry of the handle table, growing the table if needed.
+        ///
+        /// @return Index of the entry, NullIndex if out of memory.
+        uint _AcquireEntry()
+        {
+            if (_freeEntry == NullIndex)
+            {
+                sizet count = max<sizet>(_entryCount * 2, 64);
+                if (count >= NullIndex) return NullIndex;
+
+                Entry* entries = RCAST(Entry*, _allocator->ReallocateRaw(RCAST(memptr, _entries),
+                    count * sizeof(Entry), false, false, alignof(Entry)));
+                if (entries == nullptr) return NullIndex;
+
+                // link new entries in index order
+                for (sizet i = count; i > _entryCount; i--)
+                {
+                    Entry& entry = entries[i - 1];
+                    entry.offset = NPOS;
+                    entry.generation = 1;
+                    entry.nextFree = _freeEntry;
+                    _freeEntry = SCAST(uint, i - 1);
+                }
+
+                _entries = entries;
+                _entryCount = count;
+            }
+
+            uint index = _freeEntry;
+            _freeEntry = _entries[index].nextFree;
+            return index;
+        }
+
+        /// Grows the region to at least \p{size} memory units, blocks keep their offsets.
+        bool _Grow(sizet size)
+        {
+            size = AlignUp(max(size, _size * 2), BlockAlign);
+            memptr mem = _allocator->ReallocateRaw(_mem, size, false, false, BlockAlign);
+            if (mem == nullptr) return false;
+
+            _mem = mem;
+            _size = size;
+            return true;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        IAllocator* _allocator;
+        memptr _mem = nullptr;
+        sizet _size = 0;
+
+        /// Offset of the end of last block, memory after it == free.
+        sizet _top = 0;
+
+        /// Count of memory units in free blocks below \p{_top}.
+        sizet _holeSize = 0;
+
+        /// Offset of the next block Defragment() visits.
+        sizet _compactCursor = 0;
+
+        /// Offset where Defragment() moves the next live block.
+        sizet _compactDest = 0;
+
+        Entry* _entries = nullptr;
+        sizet _entryCount = 0;
+        uint _freeEntry = NullIndex;
+    };
+}
\ No newline at end of file
@@ -1,14 +1,13 @@
 #pragma once
 #include "AtomEngine/Core.hpp"
-#include "AtomEngine/Memory/FastDynamicLinkedMemPool.hpp"
+#include "AtomEngine/Memory/DynamicLinkedMemPool.hpp"
 #include "AtomEngine/Memory/GlobalAllocation.hpp"
 
 namespace Atom
 {
-    template<sizet BlockStackSize = 10>
-    class HeapMemPool: public virtual FastDynamicLinkedMemPool<BlockStackSize>
+    class HeapMemPool: public virtual DynamicLinkedMemPool
     {
-        using BaseT = FastDynamicLinkedMemPool<BlockStackSize>;
+        using BaseT = DynamicLinkedMemPool;
 
     /// ----------------------------------------------------------------------------
     public:
@@ -71,33 +71,85 @@ namespace Atom
             }
         }
 
-        /// Allocates memory according to the sizeof(T)
+        /// Allocates memory for \p{count} separate objects and Constructs each with given args.
+        /// 
+        /// @tparam T Type of objects to create.
+        /// @tparam ArgsT... Type of args used to create objects.
+        /// @param[out] outObjs Array of \p{count} ptrs, receives ptrs to the objects.
+        /// @param count Count of objects to create.
+        /// @param args... Args used to construct objects.
+        /// @return @true if all objects were created, @false if none were.
+        /// 
+        /// @note
+        /// - Unlike ConstructMultiple(), each object can be destructed on its own.
+        /// - Calls \p{AllocateBatch(sizeof(T), count, outObjs, true, alignof(T))}.
+        template <typename T, typename... ArgsT>
+        bool ConstructBatch(T** outObjs, sizet count, ArgsT &&... args)
+        {
+            if (AllocateBatch(sizeof(T), count, RCAST(memptr*, outObjs), true, alignof(T)) != true)
+            {
+                return false;
+            }
+
+            for (sizet i = 0; i < count; i++)
+            {
+                new(outObjs[i]) T(forward<ArgsT>(args)...);
+            }
+
+            return true;
+        }
+
+        /// Destructs objects created with ConstructBatch() and deallocates their memory.
+        /// 
+        /// @tparam T Type of objects to destruct.
+        /// @param objs Array of \p{count} ptrs to the objects, entries may be @nullptr.
+        /// @param count Count of objects to destruct.
+        template <typename T>
+        void DestructBatch(T** objs, sizet count)
+        {
+            for (sizet i = 0; i < count; i++)
+            {
+                if (objs[i] == nullptr) continue;
+
+                try
+                {
+                    objs[i]->T::~T();
+                }
+                catch (const std::exception&)
+                {
+                }
+            }
+
+            DeallocateBatch(RCAST(memptr*, objs), count, sizeof(T));
+        }
+
+        /// Allocates memory according to the sizeof(T) and alignof(T)
         /// @tparam T Type of object to allocate memory for.
         /// @param count Count of objects to allocate memory for.
         /// @return Ptr to first block of allocated memory.
         /// 
         /// @note
         /// - This function does not counstruct's the object,
-        /// - T == used only as a reference for size.
+        /// - T == used only as a reference for size and alignment.
         template <typename T>
         T* Allocate(sizet count = 1)
         {
-            return RCAST(T*, AllocateRaw(count * sizeof(T)));
+            return RCAST(T*, AllocateRaw(count * sizeof(T), true, alignof(T)));
         }
 
-        /// Reallocates memory according to the sizeof(T)
+        /// Reallocates memory according to the sizeof(T) and alignof(T)
         /// @tparam T Type of object to reallocate memory for.
         /// @param count Count of objects to reallocate memory for.
         /// @return Ptr to first block of reallocated memory.
         /// 
         /// @note
         /// - This function does not counstruct's the object,
-        /// - T == used only as a reference for size.
+        /// - T == used only as a reference for size and alignment.
         template <typename T>
         T* Reallocate(T* mem, sizet count)
         {
-            return RCAST(T*, ReallocateRaw(
-                RCAST(memptr, mem), count * sizeof(T)));
+            return RCAST(T*, ReallocateRaw(RCAST(memptr, mem), count * sizeof(T),
+                true, false, alignof(T)));
         }
 
         /// Deallocates memory according to the sizeof(T)
@@ -114,14 +166,77 @@ namespace Atom
             DeallocateRaw(RCAST(memptr, mem), sizeof(T) * count);
         }
 
+        /// Allocates memory aligned to \p{align}, like buffers processed with SIMD instructions.
+        /// 
+        /// @param count Count of memory units to allocate.
+        /// @param align Alignment of memory, must be a power of 2.
+        /// @param clear If true, initializes memory with 0.
+        /// @return Ptr to the memory block.
+        /// 
+        /// @note
+        /// - Calls \p{AllocateRaw(count, clear, align)}.
+        memptr AllocateAligned(sizet count, sizet align, bool clear = true)
+        {
+            return AllocateRaw(count, clear, align);
+        }
+
+        /// Allocates \p{count} separate memory blocks of \p{size} memory units each.
+        /// 
+        /// Allocators override this to serve the whole batch at once, like from a single
+        /// divided block or a chain of free blocks, instead of \p{count} calls to AllocateRaw().
+        /// 
+        /// @param size Count of memory units of each block.
+        /// @param count Count of blocks to allocate.
+        /// @param[out] outPtrs Array of \p{count} ptrs, receives ptrs to the blocks.
+        /// @param clear If true, initializes memory with 0.
+        /// @param align Alignment of each block, must be a power of 2.
+        /// @return @true if all blocks were allocated, @false if none were,
+        ///     in which case \p{outPtrs} == filled with @nullptr.
+        /// 
+        /// @note
+        /// - Each block == deallocated on its own, with DeallocateRaw() or DeallocateBatch().
+        virtual bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign)
+        {
+            for (sizet i = 0; i < count; i++)
+            {
+                outPtrs[i] = AllocateRaw(size, clear, align);
+                if (outPtrs[i] == nullptr)
+                {
+                    DeallocateBatch(outPtrs, i, size);
+                    memset(RCAST(memptr, outPtrs), 0, count * sizeof(memptr));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// Deallocates \p{count} memory blocks.
+        /// 
+        /// @param ptrs Array of \p{count} ptrs to the blocks, entries may be @nullptr.
+        /// @param count Count of blocks to deallocate.
+        /// @param size Count of memory units of each block, or 0 if unknown.
+        virtual void DeallocateBatch(memptr* ptrs, sizet count, sizet size = 0)
+        {
+            // in reverse order, so that stack like allocators, like StackAllocator
+            // given the size, pop every block
+            for (sizet i = count; i > 0; i--)
+            {
+                DeallocateRaw(ptrs[i - 1], size);
+            }
+        }
+
         /// Base = 0 function used to allocate memory.
         /// @param count Count of memory units to allocate.
         /// @param clear If true, initializes memory with 0.
+        /// @param align Alignment of memory, must be a power of 2.
+        ///              Memory == always aligned to at least \p{DefaultAlign}.
         /// @return Ptr to the memory block.
         /// 
         /// @note
         /// - This == the base underlying function used to allocate memory.
-        virtual memptr AllocateRaw(sizet count, bool clear = true) = 0;
+        virtual memptr AllocateRaw(sizet count, bool clear = true, sizet align = DefaultAlign) = 0;
 
         /// Base = 0 function used to reallocate memory.
         /// 
@@ -129,8 +244,11 @@ namespace Atom
         /// @param clear If true, initializes memory with 0.
         ///              If base memory address == same, then clears only the new portion of memory.
         /// @param clearAll If true and \p{clear} == also true, initializes complete memory portion with 0.
+        /// @param align Alignment of memory, must be a power of 2.
+        ///              Memory == always aligned to at least \p{DefaultAlign}.
         /// @return Ptr to the memory block.
-        virtual memptr ReallocateRaw(const memptr mem, sizet count, bool clear = true, bool clearAll = false) = 0;
+        virtual memptr ReallocateRaw(const memptr mem, sizet count, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) = 0;
 
         /// Base = 0 function used to deallocate memory.
         /// @param mem Ptr to memory to deallocate.
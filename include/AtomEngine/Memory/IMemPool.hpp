@@ -1,6 +1,7 @@
 #pragma once
 #include "AtomEngine/Core.hpp"
 #include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/MemPoolStats.hpp"
 
 namespace Atom
 {
@@ -10,5 +11,19 @@ namespace Atom
     {
         /// Count of memory units managed by this pool.
         virtual sizet Size() const noexcept = 0;
+
+        /// Snapshot of statistics of this pool, cheap enough to poll every frame.
+        /// 
+        /// @note
+        /// - Pools not tracking statistics only report their size.
+        /// - Reads state of the pool which == not synchronized, so call it only from
+        ///   the thread using the pool. To poll statistics from another thread,
+        ///   read MemPoolCounters of the pool instead.
+        virtual MemPoolStats Stats() const noexcept
+        {
+            MemPoolStats stats;
+            stats.size = Size();
+            return stats;
+        }
     };
 }
\ No newline at end of file
@@ -9,22 +9,15 @@ namespace Atom
         public virtual IAllocator
     {
     public:
-        memptr AllocateRaw(sizet count, bool clear = true) override final
+        memptr AllocateRaw(sizet count, bool clear = true, sizet align = DefaultAlign) override final
         {
             count = max<sizet>(0, count);
             memptr dest = nullptr;
 
             if (count > 0)
             {
-                dest = alloc(count);
-
-                if (dest != nullptr)
-                {
-                    if (clear)
-                    {
-                        memset(dest, 0, count);
-                    }
-                }
+                // pools skip clearing memory known to read 0
+                dest = globalAllocator->AllocateRaw(count, clear, align);
             }
 
             return dest;
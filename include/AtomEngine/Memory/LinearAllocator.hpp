@@ -0,0 +1,285 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IMemPool.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+
+namespace Atom
+{
+    /// LinearAllocator allocates memory by bumping an offset into a contiguous region.
+    /// 
+    /// Memory == not freed per allocation, instead all allocations are freed at once
+    /// by Reset(), which makes it suitable for data with the same lifetime,
+    /// like per frame scratch data.
+    /// 
+    /// @note
+    /// - DeallocateRaw() == a no-op.
+    /// - ReallocateRaw() resizes in place, if the memory == the last allocation.
+    ///   Other allocations are shrunk in place and moved to grow.
+    /// - Every allocation == preceded by a header of \p{BlockHeaderSize} storing its size.
+    class LinearAllocator: public virtual IMemPool
+    {
+    public:
+        /// Alignment of every allocation.
+        static constexpr sizet Align = alignof(std::max_align_t);
+
+        /// Count of memory units used by the header in front of an allocation,
+        /// when allocating with alignment of at most \p{Align}.
+        static constexpr sizet BlockHeaderSize = AlignUp(2 * sizeof(sizet), Align);
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Constructs an empty LinearAllocator, which fails every allocation.
+        LinearAllocator() noexcept { }
+
+        /// Uses memory owned by the caller.
+        /// 
+        /// @param mem Ptr to the memory region, must be aligned to \p{Align}.
+        /// @param size Count of memory units in the region.
+        LinearAllocator(memptr mem, sizet size) noexcept:
+            _mem(mem), _size(size) { }
+
+        /// Allocates the memory region from \p{allocator}, and releases it on destruction.
+        /// 
+        /// @param size Count of memory units in the region.
+        /// @param allocator Allocator used to allocate the region.
+        LinearAllocator(sizet size, IAllocator& allocator = DefaultAllocatorInstance) noexcept:
+            _allocator(&allocator)
+        {
+            _mem = allocator.AllocateRaw(size, false);
+            _size = _mem != nullptr ? size : 0;
+        }
+
+        LinearAllocator(const LinearAllocator& other) = delete;
+        LinearAllocator& operator = (const LinearAllocator& other) = delete;
+
+        LinearAllocator(LinearAllocator&& other) noexcept
+        {
+            _Swap(other);
+        }
+
+        LinearAllocator& operator = (LinearAllocator&& other) noexcept
+        {
+            LinearAllocator tmp = move(other);
+            _Swap(tmp);
+
+            return *this;
+        }
+
+        ~LinearAllocator()
+        {
+            if (_allocator != nullptr and _mem != nullptr)
+            {
+                _allocator->DeallocateRaw(_mem, _size);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        sizet Size() const noexcept override final
+        {
+            return _size;
+        }
+
+        /// Count of memory units allocated since the last Reset().
+        sizet UsedCount() const noexcept
+        {
+            return _offset;
+        }
+
+        /// Count of memory units available to allocate.
+        sizet FreeCount() const noexcept
+        {
+            return _size - _offset;
+        }
+
+        /// Free memory == contiguous, so the largest free block == all free memory.
+        MemPoolStats Stats() const noexcept override
+        {
+            MemPoolStats stats;
+            _counters.Read(stats);
+            stats.size = Size();
+            stats.usedCount = UsedCount();
+            stats.peakUsedCount = max(stats.peakUsedCount, stats.usedCount);
+            stats.freeBlockCount = FreeCount() > 0 ? 1 : 0;
+            stats.largestFreeBlock = FreeCount();
+
+            return stats;
+        }
+
+        /// Counters of Stats(), which can be read from another thread.
+        const MemPoolCounters& Counters() const noexcept
+        {
+            return _counters;
+        }
+
+        /// Resets counters of Stats(), the peak restarts at currently used memory.
+        void ResetStats() noexcept
+        {
+            _counters.Reset(UsedCount());
+        }
+
+        /// Frees all allocations at once.
+        void Reset() noexcept
+        {
+            _offset = 0;
+            _last = nullptr;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (size == 0 or size > FreeCount()) return nullptr;
+
+            memptr mem = AlignUp(_mem + _offset + sizeof(_BlockHeader), max(align, Align));
+            sizet offset = mem - _mem;
+            if (offset > _size or size > _size - offset) return nullptr;
+
+            // the end of region may not be aligned
+            sizet oldOffset = _offset;
+            _offset = min(offset + AlignUp(size, Align), _size);
+            _last = mem;
+            *_GetHeader(mem) = { oldOffset, size };
+            _counters.OnAllocate(size, _offset - oldOffset, _offset);
+
+            if (clear)
+            {
+                memset(mem, 0, _mem + _offset - mem);
+            }
+
+            return mem;
+        }
+
+        /// Checks the whole batch fits before allocating, so a failed batch uses no memory.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (count == 0) return true;
+
+            memptr mem = AlignUp(_mem + _offset + sizeof(_BlockHeader), max(align, Align));
+            sizet offset = mem - _mem;
+            sizet stride = AlignUp(AlignUp(size, Align) + sizeof(_BlockHeader), max(align, Align));
+            if (size == 0 or offset > _size or count - 1 > (_size - offset) / stride
+                or size > _size - offset - (count - 1) * stride)
+            {
+                memset(RCAST(memptr, outPtrs), 0, count * sizeof(memptr));
+                return false;
+            }
+
+            for (sizet i = 0; i < count; i++)
+            {
+                outPtrs[i] = AllocateRaw(size, clear, align);
+            }
+
+            return true;
+        }
+
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            DEBUG_ASSERT(mem >= _mem and mem < _mem + _offset, "LinearAllocator: \
+                mem == not allocated by this allocator since the last Reset().");
+
+            _BlockHeader* header = _GetHeader(mem);
+            sizet oldSize = header->size;
+            bool isAligned = IsAligned(mem, align);
+            if (isAligned and mem == _last)
+            {
+                sizet offset = mem - _mem;
+                if (size > _size - offset) return nullptr;
+
+                sizet oldOffset = _offset;
+                _offset = min(offset + AlignUp(size, Align), _size);
+                header->size = size;
+
+                if (clear)
+                {
+                    sizet clearOffset = clearAll ? 0 : min(oldSize, size);
+                    memset(mem + clearOffset, 0, size - clearOffset);
+                }
+
+                _counters.OnReallocate(oldOffset, _offset, _offset);
+                return mem;
+            }
+
+            // other allocations can only shrink in place,
+            // growing them in place would overwrite the allocations after them
+            if (isAligned and size <= oldSize)
+            {
+                header->size = size;
+                if (clear and clearAll)
+                {
+                    memset(mem, 0, size);
+                }
+
+                _counters.OnReallocate(0, 0, _offset);
+                return mem;
+            }
+
+            memptr newMem = AllocateRaw(size, false, align);
+            if (newMem == nullptr)
+            {
+                return nullptr;
+            }
+
+            sizet copySize = min(oldSize, size);
+            memcpy(newMem, mem, copySize);
+            if (clear)
+            {
+                sizet clearOffset = clearAll ? 0 : copySize;
+                memset(newMem + clearOffset, 0, size - clearOffset);
+            }
+
+            _counters.OnReallocate(0, 0, _offset);
+            return newMem;
+        }
+
+        /// Does nothing, memory == freed by Reset().
+        void DeallocateRaw(memptr mem, sizet size) override { }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Stored in front of every allocation.
+        struct _BlockHeader
+        {
+            /// Offset of the top of region before the allocation.
+            sizet offset;
+
+            /// Size requested for the allocation.
+            sizet size;
+        };
+
+        static _BlockHeader* _GetHeader(memptr mem) noexcept
+        {
+            return RCAST(_BlockHeader*, mem - sizeof(_BlockHeader));
+        }
+
+        void _Swap(LinearAllocator& other) noexcept
+        {
+            swap(_allocator, other._allocator);
+            swap(_mem, other._mem);
+            swap(_size, other._size);
+            swap(_offset, other._offset);
+            swap(_last, other._last);
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Allocator owning the memory region, nullptr if owned by the caller.
+        IAllocator* _allocator = nullptr;
+        memptr _mem = nullptr;
+        sizet _size = 0;
+        sizet _offset = 0;
+
+        /// Last allocation, resized in place by ReallocateRaw().
+        memptr _last = nullptr;
+
+        /// Statistics counters, read by Stats().
+        MemPoolCounters _counters;
+    };
+}
\ No newline at end of file
@@ -6,49 +6,191 @@
 namespace Atom
 {
     /// LinkedMemPool defines the base logic to implement a IMemPool using LinkedData structure.
-    ///
-    /// @note 
+    /// 
+    /// Each block stores its header right before the memory handed to the user, the header
+    /// also holds the size of the previous block, which acts as the footer of previous block.
+    /// So next and previous blocks are found by pointer arithmetic, and dividing and joining
+    /// blocks takes constant time without allocating any bookkeeping objects.
+    /// 
+    /// Free blocks are indexed using a two level segregated fit (TLSF) table.
+    /// The first level splits sizes by power of two, the second level splits each
+    /// power of two range linearly into \p{SLCount} classes. Two bitmaps track non empty
+    /// classes, so finding a fitting block takes constant time regardless of fragmentation.
+    /// Links of the free lists are stored inside the free memory itself.
+    /// 
+    /// Free blocks known to read 0, like memory fresh from the system, are flagged,
+    /// so allocations with \p{clear} skip clearing them.
+    /// 
+    /// @note
     /// - This type == not supposed to be used as an interface to recieve objects,
     ///   as this just defines the base functionality for code reusage, instead use IMemPool.
-    ///
-    /// @todo
-    /// - Redesign LinkedMemPool to use object memory(memory used by user during allocation) to
-    ///   allocate Block objects.
     class LinkedMemPool:
         public virtual IMemPool
     {
     protected:
-        /// Used to manage memory blocks
-        struct Block
+        /// Alignment of every memory block, also the granularity of block sizes.
+        static constexpr sizet BlockAlign = max<sizet>(alignof(std::max_align_t), 2 * sizeof(void*));
+
+        /// Used to manage memory blocks, lives right before the memory block.
+        /// 
+        /// A Chunk of memory is laid out as
+        /// \p{[Chunk][Block][mem][Block][mem] ... [Block(end)]},
+        /// where the end Block object has size 0 and == never free.
+        struct alignas(BlockAlign) Block
         {
-            /// Ptr to memory block.
-            memptr mem = nullptr;
+            /// Block is available to use.
+            static constexpr sizet FreeFlag = 1;
+
+            /// Block == the first block of its Chunk, it has no previous block.
+            static constexpr sizet RootFlag = 2;
+
+            /// Free block reads 0 after the links of free lists, set only for free blocks.
+            static constexpr sizet ZeroFlag = 4;
 
-            /// Size of this memory block.
-            sizet size = 0;
+            /// Mask of all flags stored in \p{info}.
+            static constexpr sizet FlagsMask = BlockAlign - 1;
+
+            /// Size of previous Block object's memory, the footer of previous block.
+            sizet prevSize;
+
+            /// Size of this Block object's memory, flags are stored in lower bits.
+            sizet info;
+
+            /// Size of memory block.
+            sizet Size() const noexcept
+            {
+                return info & ~FlagsMask;
+            }
+
+            /// Sets the size of memory block, and the footer read by next Block object.
+            void SetSize(sizet size) noexcept
+            {
+                info = size | (info & FlagsMask);
+                Next()->prevSize = size;
+            }
 
             /// Is this memory available to use?
-            bool isFree = true;
+            bool IsFree() const noexcept
+            {
+                return (info & FreeFlag) != 0;
+            }
+
+            void SetFree(bool isFree) noexcept
+            {
+                info = isFree ? info | FreeFlag : info & ~FreeFlag;
+            }
+
+            /// Does this free memory read 0 after the links of free lists?
+            bool IsZero() const noexcept
+            {
+                return (info & ZeroFlag) != 0;
+            }
+
+            void SetZero(bool isZero) noexcept
+            {
+                info = isZero ? info | ZeroFlag : info & ~ZeroFlag;
+            }
 
-            /// Is this * the root of memory block?
-            /// It == used to manage the memory block.
-            bool isRoot = false;
+            /// Is this the first Block object of its Chunk?
+            bool IsRoot() const noexcept
+            {
+                return (info & RootFlag) != 0;
+            }
+
+            /// Ptr to memory block.
+            memptr Mem() noexcept
+            {
+                return RCAST(memptr, this) + sizeof(Block);
+            }
+
+            /// Ptr to next Block object, placed right after this memory block.
+            Block* Next() noexcept
+            {
+                return RCAST(Block*, Mem() + Size());
+            }
+
+            /// Ptr to previous Block object, must not be called on root Block object.
+            Block* Prev() noexcept
+            {
+                return RCAST(Block*, RCAST(memptr, this) - prevSize - sizeof(Block));
+            }
+
+            /// Ptr to next free Block object of the same size class, stored in free memory.
+            Block*& NextFree() noexcept
+            {
+                return RCAST(Block**, Mem())[0];
+            }
 
-            /// Ptr to next Block object, to create linked data structure.
-            Block* next = nullptr;
+            /// Ptr to previous free Block object of the same size class, stored in free memory.
+            Block*& PrevFree() noexcept
+            {
+                return RCAST(Block**, Mem())[1];
+            }
         };
 
         /// TypeT alias to promote code readibility.
         using blockptr = Block*;
 
+        /// Memory added to the pool, lives at the start of the memory.
+        struct Chunk
+        {
+            /// Ptr to next Chunk object.
+            Chunk* next;
+
+            /// Ptr to memory, as added to the pool.
+            memptr mem;
+
+            /// Size of memory, as added to the pool.
+            sizet size;
+
+            /// Memory was allocated by the pool itself, so the pool may release it.
+            bool isOwned;
+
+            /// First Block object of this Chunk.
+            blockptr RootBlock() noexcept
+            {
+                return RCAST(blockptr, RCAST(memptr, this) + ChunkHeaderSize);
+            }
+
+            /// Is the whole memory of this Chunk free?
+            bool IsFree() noexcept
+            {
+                blockptr root = RootBlock();
+                return root->IsFree() and root->Next()->Size() == 0;
+            }
+        };
+
+        /// Size of the Chunk object including padding before the first Block object.
+        static constexpr sizet ChunkHeaderSize = AlignUp(sizeof(Chunk), BlockAlign);
+
+        /// Max count of memory units used for bookkeeping of a Chunk,
+        /// including space lost while aligning the memory.
+        static constexpr sizet ChunkOverhead = ChunkHeaderSize + 2 * sizeof(Block) + 2 * BlockAlign;
+
+        /// Min size of memory block, enough to store the links of free lists.
+        static constexpr sizet MinBlockSize = BlockAlign;
+
+        /// Log2 of count of second level size classes per first level class.
+        static constexpr sizet SLCountLog2 = 4;
+
+        /// Count of second level size classes per first level class.
+        static constexpr sizet SLCount = 1 << SLCountLog2;
+
+        /// Sizes smaller than this are mapped linearly into the first first level class.
+        static constexpr sizet SmallBlockSize = SLCount;
+
+        /// Count of first level size classes.
+        static constexpr sizet FLCount = SizeTBitCount - SLCountLog2 + 1;
+
+        SASSERT(MinBlockSize >= 2 * sizeof(blockptr), "LinkedMemPool: free block cannot store its links.");
+        SASSERT(sizeof(Block) % BlockAlign == 0, "LinkedMemPool: Block breaks memory alignment.");
+
     /// ----------------------------------------------------------------------------
     public:
         /// Default Constructor
         LinkedMemPool() noexcept:
-            _rootBlock(nullptr), _endBlock(nullptr),
-            _firstBlock(nullptr), _memoryUsed(0),
-            _freeBlock(nullptr), _reservedBlockCount(0),
-            _maxReservedBlockCount(-1) { }
+            _rootChunk(nullptr), _memoryUsed(0), _memoryTotal(0),
+            _freeBlockCount(0), _flBitmap(0), _slBitmaps{ }, _freeBlocks{ } { }
 
         /// ----------------------------------------------------------------------------
     public:
@@ -69,13 +211,57 @@ namespace Atom
             return Size() - UsedCount();
         }
 
+        /// @note
+        /// - Largest free block == found through the free table, without walking all blocks.
+        /// - Walks free blocks, so must not be called while another thread uses the pool.
+        MemPoolStats Stats() const noexcept override
+        {
+            MemPoolStats stats;
+            _counters.Read(stats);
+            stats.size = Size();
+            stats.usedCount = UsedCount();
+            stats.peakUsedCount = max(stats.peakUsedCount, stats.usedCount);
+            stats.freeBlockCount = _freeBlockCount;
+
+            if (_flBitmap != 0)
+            {
+                sizet fl = HighestBitIndex(_flBitmap);
+                sizet sl = HighestBitIndex(_slBitmaps[fl]);
+                for (blockptr block = _freeBlocks[fl][sl]; block != nullptr; block = block->NextFree())
+                {
+                    stats.largestFreeBlock = max(stats.largestFreeBlock, block->Size());
+                }
+            }
+
+            return stats;
+        }
+
+        /// Counters of Stats(), which can be read from another thread.
+        const MemPoolCounters& Counters() const noexcept
+        {
+            return _counters;
+        }
+
+        /// Resets counters of Stats(), the peak restarts at currently used memory.
+        void ResetStats() noexcept
+        {
+            _counters.Reset(UsedCount());
+        }
+
+        /// Count of usable memory units of the memory block allocated at \p{mem},
+        /// at least the size requested for it.
+        sizet GetBlockSize(const memptr mem) const noexcept
+        {
+            return mFindBlockFor(mem)->Size();
+        }
+
         /// Checks if a memory block of size \p{size} == available for allocation.
         /// 
         /// @param[in] size Size of memory block to check for, if \p{size} == 0 returns @false.
         /// @return @true if memory block exists, @false otherwise.
         virtual bool HasBlockFor(sizet size) const noexcept
         {
-            return _FindBlock(size) != nullptr;
+            return _FindBlock(_AdjustSize(size)) != nullptr;
         }
 
         /// Checks if a memory block of size \p{sizeof(T) * count} == available.
@@ -83,7 +269,7 @@ namespace Atom
         /// @tparam T TypeT of object to check memory block for.
         /// \n \p{T} == only used to find the size of TypeT.
         /// \n If \p{T} == @void, considers its size 1.
-        ///
+        /// 
         /// @param[in] count Count of objects to check memory block for,
         /// if \p{sizeof(T) * count} == 0 returns @false.
         /// 
@@ -95,129 +281,243 @@ namespace Atom
         template <typename TypeT>
         bool HasBlockFor(sizet count) const noexcept
         {
-            return _FindBlock(sizeof(TypeT) * count) != nullptr;
+            return HasBlockFor(sizeof(TypeT) * count);
         }
 
-        memptr AllocateRaw(sizet size, bool clear = true) override final
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
         {
-            blockptr block = _FindBlock(size);
-            if (block == nullptr)
+            DEBUG_ASSERT(IsValidAlign(align), "LinkedMemPool: align == not a power of 2.");
+
+            sizet requestedSize = size;
+            size = _AdjustSize(size);
+            if (size == 0)
             {
                 return nullptr;
             }
 
-            if (mDivideBlock(block, size) != true)
+            // search for a block large enough to divide a free block off its front
+            sizet searchSize = size;
+            if (align > BlockAlign)
             {
-                return nullptr;
+                if (size > NPOS - align - sizeof(Block) - MinBlockSize) return nullptr;
+                searchSize = size + align + sizeof(Block) + MinBlockSize;
+            }
+
+            blockptr block = _FindBlock(searchSize);
+            if (block == nullptr)
+            {
+                if (_TryExpand(searchSize) != true)
+                {
+                    return nullptr;
+                }
+
+                block = _FindBlock(searchSize);
+                if (block == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            _RemoveFreeBlock(block);
+            block = mAlignBlock(block, align);
+            bool isZero = block->IsZero();
+            block->SetFree(false);
+            mDivideBlock(block, size);
+            block->SetZero(false);
+
+            _memoryUsed += block->Size();
+            _counters.OnAllocate(requestedSize, block->Size(), _memoryUsed);
+            if (clear)
+            {
+                // only the links of free lists are left to clear in zero blocks
+                memset(block->Mem(), 0, isZero ? MinBlockSize : block->Size());
             }
 
-            block->isFree = false;
-            _memoryUsed += size;
-            return block->mem;
+            return block->Mem();
         }
 
-        memptr ReallocateRaw(memptr mem, sizet size, bool clear = true, bool clearAll = false) override final
+        /// Finds a single free block for the whole batch and divides it into \p{count} blocks,
+        /// so the batch costs one search and lies contiguous in memory.
+        /// If no free block == large enough, allocates blocks one by one.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
         {
-            if (mem == nullptr)
+            sizet requestedSize = size;
+            size = _AdjustSize(size);
+            if (count <= 1 or size == 0 or align > BlockAlign)
             {
-                return mem;
+                return IAllocator::AllocateBatch(requestedSize, count, outPtrs, clear, align);
+            }
+
+            // blocks after the first one need space for their Block object too
+            sizet stride = size + sizeof(Block);
+            if (count - 1 > (NPOS - size) / stride)
+            {
+                return IAllocator::AllocateBatch(requestedSize, count, outPtrs, clear, align);
+            }
+
+            sizet batchSize = size + (count - 1) * stride;
+            blockptr block = _FindBlock(batchSize);
+            if (block == nullptr and _TryExpand(batchSize))
+            {
+                block = _FindBlock(batchSize);
             }
 
-            blockptr block = mFindBlockFor(mem);
             if (block == nullptr)
             {
-                // todo: throw exception
-                // this address == not managed by this pool
-                return mem;
+                return IAllocator::AllocateBatch(requestedSize, count, outPtrs, clear, align);
+            }
+
+            _RemoveFreeBlock(block);
+            bool isZero = block->IsZero();
+            block->SetFree(false);
+            mDivideBlock(block, batchSize);
+            block->SetZero(false);
+
+            if (clear)
+            {
+                memset(block->Mem(), 0, isZero ? MinBlockSize : block->Size());
+            }
+
+            for (sizet i = 0; i < count; i++)
+            {
+                // the last block keeps the rest, if the rest was too small to divide off
+                if (i + 1 < count)
+                {
+                    sizet restSize = block->Size() - stride;
+                    block->SetSize(size);
+
+                    blockptr next = block->Next();
+                    next->info = 0;
+                    next->SetSize(restSize);
+                }
+
+                outPtrs[i] = block->Mem();
+                _memoryUsed += block->Size();
+                _counters.OnAllocate(requestedSize, block->Size(), _memoryUsed);
+                block = block->Next();
             }
 
-            if (block->isFree == true)
+            return true;
+        }
+
+        memptr ReallocateRaw(memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            blockptr block = mFindBlockFor(mem);
+            if (block->IsFree() == true)
             {
                 // todo: throw exception
                 // fatal, memory not allocated yet
                 return mem;
             }
 
-            // Requested to allocate memory of same size.
-            if (block->size == size)
+            if (size == 0)
             {
-                return mem;
+                DeallocateRaw(mem, 0);
+                return nullptr;
+            }
+
+            sizet oldSize = block->Size();
+            sizet newSize = size;
+            size = _AdjustSize(size);
+            if (size == 0)
+            {
+                return nullptr;
             }
 
+            // memory can stay in place only if it == aligned as requested
+            bool isAligned = IsAligned(mem, align);
+
             // If we need to shrink memory, no need to assign another block
-            if (block->size > size)
+            if (isAligned and oldSize >= size)
             {
-                mDivideBlock(block, block->size - size);
+                mDivideBlock(block, size);
+                _memoryUsed -= oldSize - block->Size();
+                _counters.OnReallocate(oldSize, block->Size(), _memoryUsed);
+
+                // clear the rest of block too, so that it reads 0 if grown again
+                if (clear)
+                {
+                    memptr clearMem = clearAll ? mem : mem + newSize;
+                    memset(clearMem, 0, mem + block->Size() - clearMem);
+                }
+
                 return mem;
             }
 
             // Check if we can extend already assigned memory.
-            blockptr blockNext = block->next;
-            if (blockNext->isFree and (block->size + blockNext->size >= size))
+            blockptr blockNext = block->Next();
+            if (isAligned and blockNext->IsFree() and (oldSize + sizeof(Block) + blockNext->Size() >= size))
             {
-                sizet extraSpace = block->size + blockNext->size - size;
-                if (extraSpace > 0)
+                bool isNextZero = blockNext->IsZero();
+                _RemoveFreeBlock(blockNext);
+                block->SetSize(oldSize + sizeof(Block) + blockNext->Size());
+
+                mDivideBlock(block, size);
+                _memoryUsed += block->Size() - oldSize;
+                _counters.OnReallocate(oldSize, block->Size(), _memoryUsed);
+
+                if (clear)
                 {
-                    mDivideBlock(blockNext, extraSpace);
+                    // a zero next block leaves only its Block object and links to clear
+                    memptr clearMem = clearAll ? mem : mem + oldSize;
+                    memptr clearEnd = mem + block->Size();
+                    if (isNextZero)
+                    {
+                        clearEnd = min(clearEnd, mem + oldSize + sizeof(Block) + MinBlockSize);
+                    }
+
+                    memset(clearMem, 0, clearEnd - clearMem);
                 }
 
-                mJoinBlock(block);
                 return mem;
             }
 
             // Assign another block
-            _DeallocateBlock(block);
-            return AllocateRaw(size, clear);
+            memptr newMem = AllocateRaw(size, false, align);
+            if (newMem == nullptr)
+            {
+                return nullptr;
+            }
+
+            sizet copySize = min(oldSize, newSize);
+            memcpy(newMem, mem, copySize);
+            if (clear)
+            {
+                memptr clearMem = clearAll ? newMem : newMem + copySize;
+                memset(clearMem, 0, newMem + mFindBlockFor(newMem)->Size() - clearMem);
+            }
+
+            DeallocateRaw(mem, oldSize);
+            _counters.OnReallocate(oldSize, oldSize, _memoryUsed);
+            return newMem;
         }
 
+        /// @note
+        /// - Partial deallocation == not supported, \p{size} == ignored and
+        ///   the whole memory block allocated at \p{mem} == deallocated.
         void DeallocateRaw(memptr mem, sizet size) override final
         {
             if (mem != nullptr)
             {
                 blockptr block = mFindBlockFor(mem);
-                if (block == nullptr)
-                {
-                    // todo: throw exception
-                    // this address == not managed by this pool
-                    return;
-                }
-
-                if (block->isFree == true)
+                if (block->IsFree() == true)
                 {
                     // todo: throw exception
                     // fatal, memory not allocated yet
                     return;
                 }
 
-                sizet memOffset = (byte*)mem - (byte*)block->mem;
-                sizet blockSize = block->size - memOffset;
-                if (blockSize < size)
-                {
-                    // todo: throw exception
-                    // more memory accessed than allocated
-                    return;
-                }
-
-                // if mem * == offset to bloc mem, we need to divide it into two blocks
-                if (memOffset != 0)
-                {
-                    if (mDivideBlock(block, memOffset))
-                    {
-                        block = block->next;
-                    }
-                }
-
-                // if there == also an offset from the end of the block, we need to divide again
-                memOffset = block->size - size;
-                if (memOffset > 0)
-                {
-                    if (mDivideBlock(block, size))
-                    {
-                        block->next->isFree = false;
-                    }
-                }
-
-                block->isFree = true;
+                _memoryUsed -= block->Size();
+                _counters.OnDeallocate(block->Size());
+                block->SetFree(true);
+                _InsertFreeBlock(_JoinNeighbours(block));
             }
         }
 
@@ -226,142 +526,151 @@ namespace Atom
         /// Adds memory block to the pool.
         /// 
         /// @param[in] mem Ptr to the memory block to add, if @nullptr does nothing.
-        /// @param[in] size Size of the memory block to add, if 0 does nothing.
-        /// @param[in] isRoot Is this memory address the root of memory block.
-        /// \n If @true, adds a flag for the memory address, used during deallocation of memory block.
-        ///
+        /// @param[in] size Size of the memory block to add, if too small to hold
+        ///     the bookkeeping data of the pool does nothing.
+        /// @param[in] isZero Memory block reads 0, so allocations need not clear it.
+        /// 
         /// @return Block object representing added memory block, @nullptr if memory block not added.
-        virtual blockptr _AddMemory(const memptr mem, sizet size, const bool isRoot = true)
+        /// 
+        /// @note
+        /// - Bookkeeping data of at most \p{ChunkOverhead} memory units == stored
+        ///   inside the memory block, so usable memory == smaller than \p{size}.
+        virtual blockptr _AddMemory(const memptr mem, sizet size, bool isZero = false)
         {
-            blockptr block = nullptr;
-
-            if (mem != nullptr && size != 0)
+            if (mem == nullptr or size < ChunkOverhead + MinBlockSize)
             {
-                block = mCreateBlock();
-                block->mem = mem;
-                block->size = size;
-                block->isRoot = isRoot;
-                block->isFree = true;
-                block->next = nullptr;
+                return nullptr;
+            }
 
-                if (_rootBlock == nullptr)
-                {
-                    _rootBlock = block;
-                    _endBlock = block;
-                }
-                else
-                {
-                    _endBlock->next = block;
-                    _endBlock = block;
-                }
+            memptr begin = AlignUp(mem, BlockAlign);
+            memptr end = mem + size;
 
-                _memoryTotal += size;
-            }
+            Chunk* chunk = RCAST(Chunk*, begin);
+            chunk->mem = mem;
+            chunk->size = size;
+            chunk->isOwned = false;
+            chunk->next = _rootChunk;
+            _rootChunk = chunk;
+
+            blockptr block = chunk->RootBlock();
+            sizet blockSize = AlignDown(end - block->Mem() - sizeof(Block), BlockAlign);
+
+            block->prevSize = 0;
+            block->info = Block::FreeFlag | Block::RootFlag | (isZero ? Block::ZeroFlag : 0);
+            block->SetSize(blockSize);
+
+            // end block, never free so never joined with
+            block->Next()->info = 0;
+
+            _memoryTotal += blockSize;
+            _InsertFreeBlock(block);
 
             return block;
         }
 
         /// Tries to remove memory block from this pool, fails if memory block == being used.
         /// 
-        /// @param[in] mem Ptr to memory block, if @nullptr does nothing.
-        /// @param[in] size Size of memory block to remove, if 0 does nothing.
-        /// @param[in] tillHit If @true, remove till first hit (in use memory).
-        /// @return Size of memory block removed from the pool.
+        /// @param[in] mem Ptr to memory block, as passed to _AddMemory(mem, size).
+        /// @param[in] size Size of memory block, as passed to _AddMemory(mem, size).
+        /// @return Size of memory block removed from the pool, 0 if not removed.
         /// 
         /// @note
         /// - This does not deallocates the memory block, only removes it from the pool,
         ///   so the memory block == no longer managed by this pool.
-        virtual sizet _TryRemoveMemory(const memptr mem, sizet size, const bool tillHit = true)
+        virtual sizet _TryRemoveMemory(const memptr mem, sizet size)
         {
             if (mem == nullptr) return 0;
             if (size == 0) return 0;
 
-            blockptr rootBlock = nullptr;   // root block of memory to remove
-            blockptr endBlock = nullptr;    // end block of memory to remove
-            sizet memOffset = 0;            // offset from the root block
-            sizet memInset = 0;             // offset from the end block
-            sizet memCount = 0;             // mem count we can remove
-
-            // find the block managing this memory
-            rootBlock = mFindBlockFor(mem);
-
-            // this memory == not managed by this pool
-            if (rootBlock == nullptr) return 0;
-
-            // process root for memOffset
-            memOffset = mem - rootBlock->mem;
-            memCount = rootBlock->size - memOffset;
-
-            for (blockptr block = rootBlock->next; block != nullptr; block = block->next)
+            Chunk** link = &_rootChunk;
+            for (; *link != nullptr; link = &(*link)->next)
             {
-                // stop at first hit
-                if (block->isFree != true)
-                {
-                    if (tillHit) break;
-
-                    return 0;
-                }
-
-                memCount += block->size;
-
-                if (memCount >= size)
+                if ((*link)->mem == mem and (*link)->size == size)
                 {
-                    endBlock = block;
                     break;
                 }
             }
 
-            memInset = memCount - size;
+            // this memory == not managed by this pool
+            if (*link == nullptr) return 0;
 
-            // start removing blocks now
+            Chunk* chunk = *link;
+            blockptr block = chunk->RootBlock();
 
-            if (memOffset != 0)
-            {
-                mDivideBlock(rootBlock, memOffset);
-                rootBlock = rootBlock->next;
-            }
+            // some part of memory == being used
+            if (chunk->IsFree() != true) return 0;
 
-            if (memInset != 0)
-            {
-                mDivideBlock(endBlock, endBlock->size - memInset);
-            }
+            _RemoveFreeBlock(block);
+            *link = chunk->next;
+
+            _memoryTotal -= block->Size();
+            return size;
+        }
+
+        /// Called when no free block of size \p{size} == available,
+        /// gives the pool a chance to add more memory.
+        /// 
+        /// @param[in] size Size of memory block requested.
+        /// @return @true if memory was added, @false otherwise.
+        virtual bool _TryExpand(sizet size)
+        {
+            return false;
+        }
 
-            for (blockptr block = rootBlock; block != endBlock; block = block->next)
+        /// Rounds \p{size} up to a valid size of memory block.
+        /// 
+        /// @return Size of memory block, 0 if \p{size} == 0 or too large.
+        static sizet _AdjustSize(sizet size) noexcept
+        {
+            if (size == 0 or size > NPOS - BlockAlign)
             {
-                mJoinBlock(block);
+                return 0;
             }
 
-            _memoryTotal -= memCount;
-            return 0;
+            return max(AlignUp(size, BlockAlign), MinBlockSize);
         }
 
-        /// Finds the first Block object representing free memory block of size \p{size}.
+        /// Finds a free Block object of size at least \p{size} in constant time.
+        /// 
+        /// The size == rounded up to the next size class, so that any block in the
+        /// found class fits the request (good fit instead of best fit).
+        /// Only if no such block exists, blocks in the size class of \p{size} are searched.
         /// 
         /// @param[in] size Size of memory block to search Block object for,
         ///     if \p{size} == 0 does nothing.
         /// @return Block object representing memory block, @nullptr if not found.
         virtual blockptr _FindBlock(sizet size) const noexcept
         {
-            for (auto block = _firstBlock; block != nullptr; block = block->next)
+            if (size == 0) return nullptr;
+
+            sizet fl, sl;
+            sizet roundedSize = _RoundToSizeClass(size);
+            if (roundedSize != 0)
             {
-                if (block->isFree && block->size >= size)
+                _MapSizeClass(roundedSize, fl, sl);
+
+                sizet slMap = _slBitmaps[fl] & (NPOS << sl);
+                if (slMap == 0 and fl + 1 < FLCount)
                 {
-                    return block;
+                    sizet flMap = _flBitmap & (NPOS << (fl + 1));
+                    if (flMap != 0)
+                    {
+                        fl = CountTrailingZeros(flMap);
+                        slMap = _slBitmaps[fl];
+                    }
                 }
-            }
 
-            return nullptr;
-        }
+                if (slMap != 0)
+                {
+                    sl = CountTrailingZeros(slMap);
+                    return _freeBlocks[fl][sl];
+                }
+            }
 
-        /// Finds Block object which represents memory block \p{mem}.
-        /// 
-        /// @param[in] mem Memory block to search Block object for, if @nullptr does nothing.
-        /// @return Block object representing memory block, @nullptr if not found.
-        virtual blockptr mFindBlockFor(const memptr mem) const noexcept
-        {
-            for (auto block = _rootBlock; block != nullptr; block = block->next)
+            _MapSizeClass(size, fl, sl);
+            for (blockptr block = _freeBlocks[fl][sl]; block != nullptr; block = block->NextFree())
             {
-                if (mem > block->mem and mem < (byte*)block->mem + block->size)
+                if (block->Size() >= size)
                 {
                     return block;
                 }
@@ -370,55 +679,111 @@ namespace Atom
             return nullptr;
         }
 
-        /// Divides the Block object into two Block objects of size \p{size} and \p{block->size - size}.
-        /// The new Block object will pointed by \p{block->next}.
+        /// Finds Block object which represents memory block \p{mem}.
+        /// 
+        /// @param[in] mem Memory block to search Block object for,
+        ///     must be allocated from this pool.
+        /// @return Block object representing memory block.
+        blockptr mFindBlockFor(const memptr mem) const noexcept
+        {
+            return RCAST(blockptr, mem - sizeof(Block));
+        }
+
+        /// Divides the Block object into two Block objects of size \p{size} and
+        /// \p{block->Size() - size - sizeof(Block)}.
+        /// The new Block object == placed right after \p{size} memory units, it == marked free,
+        /// joined with next free Block object and added to the free table.
+        /// It reads 0 if \p{block} == flagged so.
         /// 
         /// @param[in] block Block object to divide, if \p{block == nullptr} does nothing.
-        /// @param[in] size Size of memory block of the first Block object, if \p{size == 0} does nothing.
-        /// @return @true if successful, @false otherwise.
+        ///     Must not be present in the free table.
+        /// @param[in] size Size of memory block of the first Block object, multiple of \p{BlockAlign}.
+        /// @return @true if successful, @false if rest of memory == too small for a Block object.
         virtual bool mDivideBlock(blockptr block, sizet size)
         {
-            if (block != nullptr && block->size >= size)
+            if (block == nullptr or block->Size() < size + sizeof(Block) + MinBlockSize)
             {
-                sizet extraSize = block->size - size;
-                if (extraSize > 0)
-                {
-                    blockptr nextBlock = block->next;
-                    if (nextBlock == nullptr || nextBlock->isFree != true)
-                    {
-                        nextBlock = mCreateBlock();
-                        nextBlock->next = block->next;
-                        nextBlock->isFree = true;
-                    }
+                return false;
+            }
 
-                    nextBlock->mem = (byte*)block->mem + size;
-                    nextBlock->size += extraSize;
+            sizet restSize = block->Size() - size - sizeof(Block);
+            block->SetSize(size);
 
-                    block->size = size;
-                    block->next = nextBlock;
+            blockptr rest = block->Next();
+            rest->info = Block::FreeFlag | (block->info & Block::ZeroFlag);
+            rest->SetSize(restSize);
 
-                    return true;
-                }
+            blockptr next = rest->Next();
+            if (next->IsFree())
+            {
+                _RemoveFreeBlock(next);
+                mJoinBlock(rest);
             }
 
-            return false;
+            _InsertFreeBlock(rest);
+            return true;
+        }
+
+        /// Divides a free Block object off the front of \p{block}, so that the rest
+        /// starts at memory aligned to \p{align}.
+        /// The front Block object stays free, and == added to the free table.
+        /// 
+        /// @param[in] block Free Block object, not present in the free table.
+        ///     Must be at least \p{align + sizeof(Block) + MinBlockSize} memory units larger
+        ///     than the required size if \p{align > BlockAlign}.
+        /// @param[in] align Alignment of memory, a power of 2.
+        /// @return Block object with aligned memory, not present in the free table.
+        ///     \p{block} itself if its memory == already aligned.
+        virtual blockptr mAlignBlock(blockptr block, sizet align)
+        {
+            if (align <= BlockAlign or IsAligned(block->Mem(), align))
+            {
+                return block;
+            }
+
+            // the front block needs space for its header and free list links
+            memptr mem = block->Mem();
+            memptr alignedMem = AlignUp(mem + sizeof(Block) + MinBlockSize, align);
+            sizet frontSize = alignedMem - mem - sizeof(Block);
+            sizet size = block->Size() - frontSize - sizeof(Block);
+
+            // front block keeps flags of block, the previous block == never free
+            // as free blocks are always joined
+            block->SetSize(frontSize);
+
+            blockptr aligned = block->Next();
+            aligned->info = Block::FreeFlag | (block->info & Block::ZeroFlag);
+            aligned->SetSize(size);
+
+            _InsertFreeBlock(block);
+            return aligned;
         }
 
-        /// Joins the Block object with its next Block object if possible.
+        /// Joins the Block object with its next Block object if both are free.
+        /// The joined Block object reads 0 only if both did.
         /// 
         /// @param[in] block Block object to join with its next Block object, if @nullptr does nothing.
         /// @return @true if successful, @false otherwise.
+        /// 
+        /// @note
+        /// - Neither Block object == expected to be present in the free table.
         virtual bool mJoinBlock(blockptr block)
         {
-            if (block != nullptr and block->isFree == true)
+            if (block != nullptr and block->IsFree() == true)
             {
-                blockptr nextBlock = block->next;
-                if (nextBlock != nullptr and nextBlock->isFree == true)
+                blockptr nextBlock = block->Next();
+                if (nextBlock->IsFree() == true)
                 {
-                    block->size += nextBlock->size;
-                    block->next = nextBlock->next;
+                    sizet size = block->Size() + sizeof(Block) + nextBlock->Size();
+                    bool isZero = block->IsZero() and nextBlock->IsZero();
+                    if (isZero)
+                    {
+                        // Block object and links of next block are inside the joined memory now
+                        memset(RCAST(memptr, nextBlock), 0, sizeof(Block) + MinBlockSize);
+                    }
 
-                    _DestroyBlock(nextBlock);
+                    block->SetZero(isZero);
+                    block->SetSize(size);
                     return true;
                 }
             }
@@ -426,112 +791,128 @@ namespace Atom
             return false;
         }
 
-        /// Creates a single Block object, may allocate new Block object or use prereserved Block object.
+        /// Joins the free Block object with its previous and next free Block objects.
         /// 
-        /// @return Ptr to the Block object, @nullptr if failed.
-        virtual blockptr mCreateBlock()
+        /// @param[in] block Free Block object, not present in the free table.
+        /// @return Block object representing joined memory, not present in the free table.
+        blockptr _JoinNeighbours(blockptr block)
         {
-            blockptr block = nullptr;
-
-            if (_freeBlock != nullptr)
+            blockptr next = block->Next();
+            if (next->IsFree())
             {
-                block = _freeBlock;
-                _freeBlock = _freeBlock->next;
-
-                *block = Block();
-                _reservedBlockCount--;
+                _RemoveFreeBlock(next);
+                mJoinBlock(block);
             }
-            else
+
+            if (block->IsRoot() != true)
             {
-                block->next = _AllocateBlocks(1);
+                blockptr prev = block->Prev();
+                if (prev->IsFree())
+                {
+                    _RemoveFreeBlock(prev);
+                    mJoinBlock(prev);
+                    block = prev;
+                }
             }
 
             return block;
         }
 
-        /// Destroys Block object, may not deallocate memory and preserve it.
+        /// Rounds \p{size} up to the start of next size class, every free block
+        /// of that class or above can hold \p{size} memory units.
         /// 
-        /// @param[in] block Ptr to the Block object.
-        virtual void _DestroyBlock(blockptr block)
+        /// @return Rounded size, 0 if \p{size} == 0 or too large.
+        static sizet _RoundToSizeClass(sizet size) noexcept
         {
-            if (_reservedBlockCount < _maxReservedBlockCount)
+            if (size < SmallBlockSize)
+            {
+                return size;
+            }
+
+            sizet round = (SCAST(sizet, 1) << (HighestBitIndex(size) - SLCountLog2)) - 1;
+            if (size > NPOS - round)
             {
-                *block = Block();
-                block->next = _freeBlock;
+                return 0;
+            }
 
-                _freeBlock = block;
+            return (size + round) & ~round;
+        }
+
+        /// Maps \p{size} to its first and second level size class.
+        static void _MapSizeClass(sizet size, sizet& fl, sizet& sl) noexcept
+        {
+            if (size < SmallBlockSize)
+            {
+                fl = 0;
+                sl = size;
             }
             else
             {
-                _DeallocateBlock(block);
+                sizet msb = HighestBitIndex(size);
+                fl = msb - SLCountLog2 + 1;
+                sl = (size >> (msb - SLCountLog2)) ^ SLCount;
             }
         }
 
-        /// Reserves \p{count} Block instances used to manage memory.
-        /// 
-        /// @param[in] count Count of Block instances to reserve.
-        virtual void _ReserveBlocks(sizet count)
+        /// Adds the free Block object to the head of its size class list.
+        void _InsertFreeBlock(blockptr block) noexcept
         {
-            if (_reservedBlockCount < count)
+            sizet fl, sl;
+            _MapSizeClass(block->Size(), fl, sl);
+
+            blockptr head = _freeBlocks[fl][sl];
+            block->PrevFree() = nullptr;
+            block->NextFree() = head;
+            if (head != nullptr)
             {
-                _ReserveMoreBlocks(count - _reservedBlockCount);
+                head->PrevFree() = block;
             }
+
+            _freeBlocks[fl][sl] = block;
+            _freeBlockCount++;
+            _flBitmap |= SCAST(sizet, 1) << fl;
+            _slBitmaps[fl] |= SCAST(sizet, 1) << sl;
         }
 
-        /// Reserves count more Block objects used to manage memory.
-        /// 
-        /// @param[in] count Count of Block objects to reserve.
-        /// 
-        /// @note
-        /// - This call == gaurenteed to cause allocation if \p{count > 0}.
-        virtual void _ReserveMoreBlocks(sizet count)
+        /// Removes the free Block object from its size class list.
+        void _RemoveFreeBlock(blockptr block) noexcept
         {
-            if (count != 0)
-            {
-                blockptr rootBlock = _AllocateBlocks(count);
-                blockptr endBlock = rootBlock;
-                for (; endBlock->next != nullptr; endBlock = endBlock->next)
-                {
-                    _reservedBlockCount++;
-                }
+            sizet fl, sl;
+            _MapSizeClass(block->Size(), fl, sl);
 
-                if (_freeBlock != nullptr)
-                {
-                    endBlock->next = _freeBlock;
-                }
+            blockptr prevFree = block->PrevFree();
+            blockptr nextFree = block->NextFree();
 
-                _freeBlock = rootBlock;
+            if (prevFree != nullptr)
+            {
+                prevFree->NextFree() = nextFree;
+            }
+            else
+            {
+                _freeBlocks[fl][sl] = nextFree;
             }
-        }
 
-        /// Allocates Block object used to manage memory.
-        /// 
-        /// @param[in] count Count of Block objects to allocate.
-        /// @return Ptr to array of Block objects.
-        virtual blockptr _AllocateBlocks(sizet count)
-        {
-            return createArr<Block>(count);
-        }
+            if (nextFree != nullptr)
+            {
+                nextFree->PrevFree() = prevFree;
+            }
 
-        /// Deallocates Block objects used to manage memory.
-        /// 
-        /// @param[in] block objects * to Block objects
-        /// @param[in] count count of Block objects
-        virtual void _DeallocateBlock(blockptr block)
-        {
-            destroy(block);
+            _freeBlockCount--;
+
+            if (_freeBlocks[fl][sl] == nullptr)
+            {
+                _slBitmaps[fl] &= ~(SCAST(sizet, 1) << sl);
+                if (_slBitmaps[fl] == 0)
+                {
+                    _flBitmap &= ~(SCAST(sizet, 1) << fl);
+                }
+            }
         }
 
     /// ----------------------------------------------------------------------------
     protected:
-        /// Ptr to Root Block object of memory table.
-        blockptr _rootBlock;
-
-        /// Ptr to End Block object of memory table.
-        blockptr _endBlock;
-
-        /// Ptr to First Block object with available memory.
-        blockptr _firstBlock;
+        /// Ptr to the last added Chunk object, chunks are linked to previously added ones.
+        Chunk* _rootChunk;
 
         /// Count of memory units used.
         sizet _memoryUsed;
@@ -539,20 +920,25 @@ namespace Atom
         /// Total count of memory units managed by this pool.
         sizet _memoryTotal;
 
-        /// Ptr to the first reserved Block object.
-        blockptr _freeBlock;
+        /// Count of Block objects in the free table.
+        sizet _freeBlockCount;
+
+        /// Statistics counters, read by Stats().
+        MemPoolCounters _counters;
+
+        /// Bitmap of first level size classes having free Block objects.
+        sizet _flBitmap;
 
-        /// Current count of reserved Block objects.
-        sizet _reservedBlockCount;
+        /// Bitmaps of second level size classes having free Block objects.
+        sizet _slBitmaps[FLCount];
 
-        /// Max count of Block objects to reserve,
-        /// if \p{value == 0} no Block objects are reserved.
-        sizet _maxReservedBlockCount;
+        /// Lists of free Block objects for each size class.
+        blockptr _freeBlocks[FLCount][SLCount];
     };
 
     template <>
     inline bool LinkedMemPool::HasBlockFor<void>(sizet count) const noexcept
     {
-        return _FindBlock(count) != nullptr;
+        return HasBlockFor(count);
     }
 }
\ No newline at end of file
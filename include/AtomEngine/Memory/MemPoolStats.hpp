@@ -0,0 +1,200 @@
+#pragma once
+#include <atomic>
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/Core.hpp"
+
+/// Set to 0 to compile out statistics counters of memory pools,
+/// MemPoolStats then only reports data the pools track anyway.
+#if !defined(ATOM_MEMORY_STATS)
+#define ATOM_MEMORY_STATS 1
+#endif
+
+namespace Atom
+{
+    /// Snapshot of statistics of a IMemPool, returned by IMemPool::Stats().
+    /// 
+    /// @note
+    /// - Counters are 0 if compiled with \p{ATOM_MEMORY_STATS == 0}.
+    /// - A reallocation which moves memory also counts as an allocation and a deallocation.
+    struct MemPoolStats
+    {
+        /// Count of buckets in the size histogram, bucket \p{i} counts allocations of
+        /// size in range \p{[2^(i-1), 2^i)}, the last bucket counts every larger allocation.
+        static constexpr sizet HistogramCount = 24;
+
+        /// Count of memory units managed by the pool.
+        sizet size = 0;
+
+        /// Count of memory units in use.
+        sizet usedCount = 0;
+
+        /// Highest count of memory units in use at once.
+        sizet peakUsedCount = 0;
+
+        /// Count of calls to AllocateRaw().
+        sizet allocCount = 0;
+
+        /// Count of calls to DeallocateRaw().
+        sizet deallocCount = 0;
+
+        /// Count of calls to ReallocateRaw().
+        sizet reallocCount = 0;
+
+        /// Count of memory units handed out by allocations and reallocations, including padding.
+        sizet allocBytes = 0;
+
+        /// Count of memory units returned by deallocations and reallocations, including padding.
+        sizet deallocBytes = 0;
+
+        /// Count of free memory blocks.
+        sizet freeBlockCount = 0;
+
+        /// Size of the largest free memory block.
+        sizet largestFreeBlock = 0;
+
+        /// Count of allocations by requested size, see \p{HistogramCount}.
+        sizet histogram[HistogramCount] = { };
+
+        /// Count of free memory units.
+        sizet FreeCount() const noexcept
+        {
+            return size - usedCount;
+        }
+
+        /// External fragmentation, the fraction of free memory not usable by
+        /// a single allocation. 0 if all free memory == contiguous, approaches 1
+        /// as free memory == split in many small blocks.
+        float Fragmentation() const noexcept
+        {
+            sizet freeCount = FreeCount();
+            if (freeCount == 0) return 0;
+
+            return 1 - SCAST(float, largestFreeBlock) / SCAST(float, freeCount);
+        }
+
+        /// Index of the histogram bucket counting allocations of \p{size}.
+        static sizet HistogramIndex(sizet size) noexcept
+        {
+            if (size == 0) return 0;
+
+            return min(HighestBitIndex(size) + 1, HistogramCount - 1);
+        }
+    };
+
+    /// Counters of MemPoolStats updated by memory pools on every operation.
+    /// 
+    /// Counters are atomic and updated with relaxed ordering, so Read() can be called
+    /// from another thread (like a profiler overlay polling every frame), while the pool
+    /// keeps serving its own thread. Pools expose their counters through Counters().
+    /// Unlike Read(), IMemPool::Stats() also reads state of the pool which == not
+    /// atomic, and must be called only from the thread using the pool.
+    /// With \p{ATOM_MEMORY_STATS == 0} this type == empty and every call compiles to nothing.
+    class MemPoolCounters
+    {
+    public:
+        MemPoolCounters() noexcept = default;
+
+        MemPoolCounters(const MemPoolCounters& other) = delete;
+        MemPoolCounters& operator = (const MemPoolCounters& other) = delete;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Records an allocation of \p{size} requested memory units, which took
+        /// \p{blockSize} memory units, \p{usedCount} == the used memory after allocation.
+        void OnAllocate(sizet size, sizet blockSize, sizet usedCount) noexcept
+        {
+        #if ATOM_MEMORY_STATS
+            _allocCount.fetch_add(1, std::memory_order_relaxed);
+            _allocBytes.fetch_add(blockSize, std::memory_order_relaxed);
+            _histogram[MemPoolStats::HistogramIndex(size)].fetch_add(1, std::memory_order_relaxed);
+            _UpdatePeak(usedCount);
+        #endif
+        }
+
+        /// Records a deallocation of \p{blockSize} memory units.
+        void OnDeallocate(sizet blockSize) noexcept
+        {
+        #if ATOM_MEMORY_STATS
+            _deallocCount.fetch_add(1, std::memory_order_relaxed);
+            _deallocBytes.fetch_add(blockSize, std::memory_order_relaxed);
+        #endif
+        }
+
+        /// Records a reallocation which resized memory from \p{oldBlockSize} to \p{blockSize}
+        /// in place, \p{usedCount} == the used memory after reallocation.
+        /// 
+        /// @note A reallocation which moves memory records the new and old memory through
+        ///     OnAllocate() and OnDeallocate(), and passes equal sizes here.
+        void OnReallocate(sizet oldBlockSize, sizet blockSize, sizet usedCount) noexcept
+        {
+        #if ATOM_MEMORY_STATS
+            _reallocCount.fetch_add(1, std::memory_order_relaxed);
+            if (blockSize > oldBlockSize)
+            {
+                _allocBytes.fetch_add(blockSize - oldBlockSize, std::memory_order_relaxed);
+            }
+            else
+            {
+                _deallocBytes.fetch_add(oldBlockSize - blockSize, std::memory_order_relaxed);
+            }
+
+            _UpdatePeak(usedCount);
+        #endif
+        }
+
+        /// Copies counters into \p{stats}, other fields of \p{stats} are left untouched.
+        void Read(MemPoolStats& stats) const noexcept
+        {
+        #if ATOM_MEMORY_STATS
+            stats.allocCount = _allocCount.load(std::memory_order_relaxed);
+            stats.deallocCount = _deallocCount.load(std::memory_order_relaxed);
+            stats.reallocCount = _reallocCount.load(std::memory_order_relaxed);
+            stats.allocBytes = _allocBytes.load(std::memory_order_relaxed);
+            stats.deallocBytes = _deallocBytes.load(std::memory_order_relaxed);
+            stats.peakUsedCount = _peakUsedCount.load(std::memory_order_relaxed);
+
+            for (sizet i = 0; i < MemPoolStats::HistogramCount; i++)
+            {
+                stats.histogram[i] = _histogram[i].load(std::memory_order_relaxed);
+            }
+        #endif
+        }
+
+        /// Sets all counters to 0, the peak restarts at \p{usedCount}.
+        void Reset(sizet usedCount = 0) noexcept
+        {
+        #if ATOM_MEMORY_STATS
+            _allocCount.store(0, std::memory_order_relaxed);
+            _deallocCount.store(0, std::memory_order_relaxed);
+            _reallocCount.store(0, std::memory_order_relaxed);
+            _allocBytes.store(0, std::memory_order_relaxed);
+            _deallocBytes.store(0, std::memory_order_relaxed);
+            _peakUsedCount.store(usedCount, std::memory_order_relaxed);
+
+            for (auto& count : _histogram)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        #endif
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+    #if ATOM_MEMORY_STATS
+        void _UpdatePeak(sizet usedCount) noexcept
+        {
+            sizet peak = _peakUsedCount.load(std::memory_order_relaxed);
+            while (usedCount > peak and _peakUsedCount.compare_exchange_weak(peak, usedCount,
+                std::memory_order_relaxed) != true) { }
+        }
+
+        std::atomic<sizet> _allocCount{ 0 };
+        std::atomic<sizet> _deallocCount{ 0 };
+        std::atomic<sizet> _reallocCount{ 0 };
+        std::atomic<sizet> _allocBytes{ 0 };
+        std::atomic<sizet> _deallocBytes{ 0 };
+        std::atomic<sizet> _peakUsedCount{ 0 };
+        std::atomic<sizet> _histogram[MemPoolStats::HistogramCount] = { };
+    #endif
+    };
+}
\ No newline at end of file
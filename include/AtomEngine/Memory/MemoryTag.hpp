@@ -0,0 +1,299 @@
+#pragma once
+#include <cstring>
+#include <mutex>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IMemPool.hpp"
+
+namespace Atom
+{
+    /// MemoryTag == a named allocator of a subsystem, like rendering or audio, which tracks
+    /// how much memory the subsystem uses against its budget.
+    ///
+    /// Each tag allocates from its own pool, see TMemoryTag, so memory of subsystems never
+    /// mixes and usage == read from the pool. Tags register themselves on construction,
+    /// so all tags can be listed with GetAllUsage() or found by name with Find().
+    ///
+    /// The budget == soft. When an allocation would take usage over the budget, the over budget
+    /// function == called first, where the subsystem can evict its caches, and the allocation
+    /// proceeds afterwards. The function == called once when usage crosses the budget, and again
+    /// only after usage dropped within the budget.
+    ///
+    /// @note
+    /// - Calls to the pool are serialized by a lock of the tag, so a tag can be shared by threads.
+    /// - The over budget function == called without the lock held, so it can deallocate
+    ///   memory of the same tag.
+    class MemoryTag: public virtual IAllocator
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Called when an allocation of \p{size} memory units would take usage over the budget.
+        using OverBudgetFuncT = void(*)(MemoryTag& tag, sizet size, void* userData);
+
+        /// Snapshot of usage of a tag, returned by GetUsage().
+        struct Usage
+        {
+            const char* name = nullptr;
+
+            /// Budget in memory units, NPOS if unlimited.
+            sizet budget = NPOS;
+
+            /// Count of memory units in use, as reported by the pool.
+            sizet usedCount = 0;
+
+            /// Highest count of memory units in use at once.
+            sizet peakUsedCount = 0;
+
+            /// Count of calls to AllocateRaw() and ReallocateRaw().
+            sizet allocCount = 0;
+
+            /// Count of times usage crossed the budget.
+            sizet overBudgetCount = 0;
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param name Name of the tag, must outlive the tag, like a string literal.
+        /// @param budget Budget in memory units, NPOS if unlimited.
+        MemoryTag(const char* name, sizet budget = NPOS) noexcept:
+            _name(name), _budget(budget)
+        {
+            std::lock_guard<std::mutex> guard(_registryLock);
+            _next = _rootTag;
+            _rootTag = this;
+        }
+
+        MemoryTag(const MemoryTag& other) = delete;
+        MemoryTag& operator = (const MemoryTag& other) = delete;
+
+        ~MemoryTag()
+        {
+            std::lock_guard<std::mutex> guard(_registryLock);
+            MemoryTag** link = &_rootTag;
+            while (*link != this)
+            {
+                link = &(*link)->_next;
+            }
+
+            *link = _next;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        const char* Name() const noexcept
+        {
+            return _name;
+        }
+
+        sizet Budget() const noexcept
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            return _budget;
+        }
+
+        /// @param budget Budget in memory units, NPOS if unlimited.
+        void SetBudget(sizet budget) noexcept
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _budget = budget;
+            _isOverBudget = _usedCount > _budget;
+        }
+
+        /// @param func Function to call when usage crosses the budget, @nullptr for none.
+        /// @param userData Passed to \p{func}.
+        void SetOverBudgetFunc(OverBudgetFuncT func, void* userData = nullptr) noexcept
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _overBudgetFunc = func;
+            _overBudgetUserData = userData;
+        }
+
+        Usage GetUsage() const noexcept
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+
+            Usage usage;
+            usage.name = _name;
+            usage.budget = _budget;
+            usage.usedCount = _usedCount;
+            usage.peakUsedCount = _peakUsedCount;
+            usage.allocCount = _allocCount;
+            usage.overBudgetCount = _overBudgetCount;
+            return usage;
+        }
+
+        /// Peak restarts at currently used memory.
+        void ResetPeak() noexcept
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _peakUsedCount = _usedCount;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Finds the tag named \p{name}, @nullptr if none.
+        static MemoryTag* Find(const char* name) noexcept
+        {
+            std::lock_guard<std::mutex> guard(_registryLock);
+            for (MemoryTag* tag = _rootTag; tag != nullptr; tag = tag->_next)
+            {
+                if (strcmp(tag->_name, name) == 0) return tag;
+            }
+
+            return nullptr;
+        }
+
+        /// Writes usage of registered tags, most recently constructed first.
+        ///
+        /// @param[out] outUsages Array of \p{count} entries, receives usage of each tag.
+        /// @param count Max count of entries to write.
+        /// @return Count of registered tags, may be more than \p{count}.
+        static sizet GetAllUsage(Usage* outUsages, sizet count) noexcept
+        {
+            std::lock_guard<std::mutex> guard(_registryLock);
+            sizet tagCount = 0;
+            for (MemoryTag* tag = _rootTag; tag != nullptr; tag = tag->_next)
+            {
+                if (tagCount < count)
+                {
+                    outUsages[tagCount] = tag->GetUsage();
+                }
+
+                tagCount++;
+            }
+
+            return tagCount;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            _CheckBudget(size);
+
+            std::lock_guard<std::mutex> guard(_lock);
+            memptr mem = _pool->AllocateRaw(size, clear, align);
+            _allocCount++;
+            _UpdateUsage();
+            return mem;
+        }
+
+        /// Checks the budget against the whole new size, as the pool may need both
+        /// the old and the new memory while moving.
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            _CheckBudget(size);
+
+            std::lock_guard<std::mutex> guard(_lock);
+            memptr newMem = _pool->ReallocateRaw(mem, size, clear, clearAll, align);
+            _allocCount++;
+            _UpdateUsage();
+            return newMem;
+        }
+
+        void DeallocateRaw(const memptr mem, sizet size) override final
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _pool->DeallocateRaw(mem, size);
+            _UpdateUsage();
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Count of memory units in use in the pool, called with the lock held.
+        virtual sizet _GetPoolUsedCount() const noexcept = 0;
+
+        /// Calls the over budget function if \p{size} more memory units would take usage
+        /// over the budget for the first time since it was within.
+        void _CheckBudget(sizet size)
+        {
+            OverBudgetFuncT func;
+            void* userData;
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                if (_isOverBudget or size <= _budget - min(_usedCount, _budget)) return;
+
+                _isOverBudget = true;
+                _overBudgetCount++;
+                func = _overBudgetFunc;
+                userData = _overBudgetUserData;
+            }
+
+            if (func != nullptr)
+            {
+                func(*this, size, userData);
+            }
+        }
+
+        /// Reads usage from the pool, called with the lock held.
+        void _UpdateUsage() noexcept
+        {
+            _usedCount = _GetPoolUsedCount();
+            _peakUsedCount = max(_peakUsedCount, _usedCount);
+            if (_usedCount <= _budget)
+            {
+                _isOverBudget = false;
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Pool of the tag, set by the derived type.
+        IMemPool* _pool = nullptr;
+
+        const char* _name;
+        sizet _budget;
+        sizet _usedCount = 0;
+        sizet _peakUsedCount = 0;
+        sizet _allocCount = 0;
+        sizet _overBudgetCount = 0;
+        bool _isOverBudget = false;
+
+        OverBudgetFuncT _overBudgetFunc = nullptr;
+        void* _overBudgetUserData = nullptr;
+        mutable std::mutex _lock;
+
+        /// Next registered tag.
+        MemoryTag* _next = nullptr;
+
+        static inline std::mutex _registryLock;
+        static inline MemoryTag* _rootTag = nullptr;
+    };
+
+    /// MemoryTag which owns its pool of type \p{PoolT}, like HeapMemPool or LinearAllocator.
+    ///
+    /// @tparam PoolT Type of the pool, provides \p{UsedCount()}.
+    template <typename PoolT>
+    class TMemoryTag: public MemoryTag
+    {
+    public:
+        /// @param name Name of the tag, must outlive the tag, like a string literal.
+        /// @param budget Budget in memory units, NPOS if unlimited.
+        /// @param args Args used to construct the pool.
+        template <typename... ArgsT>
+        TMemoryTag(const char* name, sizet budget, ArgsT&&... args) noexcept:
+            MemoryTag(name, budget), _ownPool(forward<ArgsT>(args)...)
+        {
+            _pool = &_ownPool;
+            _usedCount = _ownPool.UsedCount();
+            _peakUsedCount = _usedCount;
+        }
+
+    public:
+        /// Pool of the tag, calls to it bypass the lock and usage tracking of the tag.
+        PoolT& Pool() noexcept
+        {
+            return _ownPool;
+        }
+
+    protected:
+        sizet _GetPoolUsedCount() const noexcept override final
+        {
+            return _ownPool.UsedCount();
+        }
+
+    protected:
+        PoolT _ownPool;
+    };
+}
\ No newline at end of file
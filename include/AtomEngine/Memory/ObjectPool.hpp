@@ -0,0 +1,462 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IDynamicMemPool.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+
+namespace Atom
+{
+    /// TObjectPool manages memory for objects of a single type.
+    /// 
+    /// Memory == taken from the backing allocator in pages, each page == divided into
+    /// fixed size slots. Free slots are linked through their own memory, so allocations
+    /// and deallocations are O(1) and allocated slots have no header.
+    /// Pages grow geometrically, so the count of pages stays logarithmic in the count of slots.
+    /// Each page keeps an occupancy bitmap, which Shrink() uses to find free pages.
+    /// 
+    /// @note Slots are aligned to \p{SlotAlign}, which == at least \p{DefaultAlign},
+    ///       so calls through IAllocator with the default alignment get aligned memory.
+    ///       Requests for larger alignment fail.
+    /// 
+    /// @tparam TypeT Type of objects to manage memory for.
+    /// @tparam PageSlotCount Count of slots of the first page, later pages double
+    ///     the count of slots of the pool up to \p{MaxPageSize}.
+    template <typename TypeT, sizet PageSlotCount = 64>
+    class TObjectPool: public virtual IDynamicMemPool
+    {
+        static_assert(PageSlotCount > 0, "TObjectPool: PageSlotCount == 0.");
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Free slot, linked with other free slots.
+        struct Slot
+        {
+            Slot* next;
+        };
+
+        /// Header placed at the start of each page, followed by the bitmap of free slots.
+        struct Page
+        {
+            Page* next;
+            sizet slotCount;
+        };
+
+    public:
+        /// Alignment of each slot.
+        static constexpr sizet SlotAlign = max(max(alignof(TypeT), alignof(Slot)), DefaultAlign);
+
+        /// Count of memory units in each slot.
+        static constexpr sizet SlotSize = AlignUp(max(sizeof(TypeT), sizeof(Slot)), SlotAlign);
+
+        /// Count of memory units a page grows to at most, unless \p{PageSlotCount} slots need more.
+        static constexpr sizet MaxPageSize = 1024 * 1024;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param allocator Allocator used to allocate pages.
+        TObjectPool(IAllocator& allocator = DefaultAllocatorInstance) noexcept:
+            _allocator(&allocator) { }
+
+        TObjectPool(const TObjectPool& other) = delete;
+        TObjectPool& operator = (const TObjectPool& other) = delete;
+
+        ~TObjectPool()
+        {
+            while (_rootPage != nullptr)
+            {
+                Page* page = _rootPage;
+                _rootPage = page->next;
+
+                _DeallocatePage(page);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        sizet Size() const noexcept override final
+        {
+            return _slotCount * SlotSize;
+        }
+
+        /// Count of memory units in allocated slots.
+        sizet UsedCount() const noexcept
+        {
+            return _usedSlotCount * SlotSize;
+        }
+
+        /// Count of memory units in free slots.
+        sizet FreeCount() const noexcept
+        {
+            return (_slotCount - _usedSlotCount) * SlotSize;
+        }
+
+        /// @note Every free slot == a free block of \p{SlotSize}, as every allocation
+        ///     fits in a slot, fragmentation does not limit allocations of this pool.
+        MemPoolStats Stats() const noexcept override
+        {
+            MemPoolStats stats;
+            _counters.Read(stats);
+            stats.size = Size();
+            stats.usedCount = UsedCount();
+            stats.peakUsedCount = max(stats.peakUsedCount, stats.usedCount);
+            stats.freeBlockCount = _slotCount - _usedSlotCount;
+            stats.largestFreeBlock = stats.freeBlockCount > 0 ? SlotSize : 0;
+
+            return stats;
+        }
+
+        /// Counters of Stats(), which can be read from another thread.
+        const MemPoolCounters& Counters() const noexcept
+        {
+            return _counters;
+        }
+
+        /// Resets counters of Stats(), the peak restarts at currently used memory.
+        void ResetStats() noexcept
+        {
+            _counters.Reset(UsedCount());
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Allocates a slot.
+        /// 
+        /// @return nullptr if \p{size} == 0, \p{size} > SlotSize or \p{align} > SlotAlign.
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (size == 0 or size > SlotSize or align > SlotAlign) return nullptr;
+
+            if (_freeSlot == nullptr)
+            {
+                if (_AddPage(_NextPageSlotCount()) == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            Slot* slot = _freeSlot;
+            _freeSlot = slot->next;
+            _usedSlotCount++;
+            _counters.OnAllocate(size, SlotSize, UsedCount());
+
+            memptr mem = RCAST(memptr, slot);
+            if (clear)
+            {
+                memset(mem, 0, SlotSize);
+            }
+
+            return mem;
+        }
+
+        /// Allocates \p{count} slots, adding at most one page and popping them off
+        /// the free list at once.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (count == 0) return true;
+
+            if (size == 0 or size > SlotSize or align > SlotAlign)
+            {
+                memset(RCAST(memptr, outPtrs), 0, count * sizeof(memptr));
+                return false;
+            }
+
+            sizet freeSlotCount = _slotCount - _usedSlotCount;
+            if (count > freeSlotCount)
+            {
+                if (_AddPage(max(count - freeSlotCount, _NextPageSlotCount())) == nullptr)
+                {
+                    memset(RCAST(memptr, outPtrs), 0, count * sizeof(memptr));
+                    return false;
+                }
+            }
+
+            Slot* slot = _freeSlot;
+            for (sizet i = 0; i < count; i++)
+            {
+                outPtrs[i] = RCAST(memptr, slot);
+                slot = slot->next;
+
+                if (clear)
+                {
+                    memset(outPtrs[i], 0, SlotSize);
+                }
+            }
+
+            _freeSlot = slot;
+            _usedSlotCount += count;
+            for (sizet i = 0; i < count; i++)
+            {
+                _counters.OnAllocate(size, SlotSize, UsedCount());
+            }
+
+            return true;
+        }
+
+        /// Slots cannot be resized, so reallocation succeeds only in place.
+        /// 
+        /// @return nullptr if \p{size} > SlotSize or \p{align} > SlotAlign.
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            if (size == 0)
+            {
+                DeallocateRaw(mem, SlotSize);
+                return nullptr;
+            }
+
+            if (size > SlotSize or align > SlotAlign) return nullptr;
+
+            if (clear)
+            {
+                sizet offset = clearAll ? 0 : size;
+                memset(mem + offset, 0, SlotSize - offset);
+            }
+
+            _counters.OnReallocate(SlotSize, SlotSize, UsedCount());
+            return mem;
+        }
+
+        /// Returns the slot to the pool.
+        /// 
+        /// @note \p{size} == ignored, partial deallocation == not supported.
+        void DeallocateRaw(memptr mem, sizet size) override final
+        {
+            if (mem == nullptr) return;
+
+            DEBUG_ASSERT(_usedSlotCount > 0, "TObjectPool: deallocating, \
+                but no slot == allocated.");
+
+            Slot* slot = RCAST(Slot*, mem);
+            slot->next = _freeSlot;
+            _freeSlot = slot;
+            _usedSlotCount--;
+            _counters.OnDeallocate(SlotSize);
+        }
+
+        /// Links the slots together and pushes them onto the free list at once.
+        /// 
+        /// @note \p{size} == ignored.
+        void DeallocateBatch(memptr* ptrs, sizet count, sizet size = 0) override final
+        {
+            // link in reverse, so that ptrs[0] == allocated first again
+            Slot* first = nullptr;
+            Slot* last = nullptr;
+            sizet freedCount = 0;
+            for (sizet i = count; i > 0; i--)
+            {
+                if (ptrs[i - 1] == nullptr) continue;
+
+                Slot* slot = RCAST(Slot*, ptrs[i - 1]);
+                slot->next = first;
+                first = slot;
+                if (last == nullptr) last = slot;
+                freedCount++;
+            }
+
+            if (first == nullptr) return;
+
+            DEBUG_ASSERT(_usedSlotCount >= freedCount, "TObjectPool: deallocating, \
+                but not as many slots are allocated.");
+
+            last->next = _freeSlot;
+            _freeSlot = first;
+            _usedSlotCount -= freedCount;
+            for (sizet i = 0; i < freedCount; i++)
+            {
+                _counters.OnDeallocate(SlotSize);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Releases pages whose slots are all free.
+        /// 
+        /// Marks free slots in the bitmaps of their pages, then relinks free slots of the pages
+        /// that stay in address order.
+        void Shrink() override final
+        {
+            for (Page* page = _rootPage; page != nullptr; page = page->next)
+            {
+                memset(RCAST(memptr, _GetBitmap(page)), 0,
+                    _BitmapWordCount(page->slotCount) * sizeof(sizet));
+            }
+
+            for (Slot* slot = _freeSlot; slot != nullptr; slot = slot->next)
+            {
+                // newer pages are larger, so most slots are found in the first pages
+                Page* page = _rootPage;
+                while (_HasSlot(page, slot) != true)
+                {
+                    page = page->next;
+                }
+
+                sizet index = (RCAST(memptr, slot) - _GetSlots(page)) / SlotSize;
+                _GetBitmap(page)[index / SizeTBitCount] |= SCAST(sizet, 1) << (index % SizeTBitCount);
+            }
+
+            _freeSlot = nullptr;
+            Slot** tail = &_freeSlot;
+
+            Page** link = &_rootPage;
+            while (*link != nullptr)
+            {
+                Page* page = *link;
+                if (_IsPageFree(page))
+                {
+                    _slotCount -= page->slotCount;
+
+                    *link = page->next;
+                    _DeallocatePage(page);
+                    continue;
+                }
+
+                sizet* bitmap = _GetBitmap(page);
+                memptr slots = _GetSlots(page);
+                for (sizet i = 0; i < _BitmapWordCount(page->slotCount); i++)
+                {
+                    for (sizet word = bitmap[i]; word != 0; word &= word - 1)
+                    {
+                        sizet index = i * SizeTBitCount + CountTrailingZeros(word);
+                        Slot* slot = RCAST(Slot*, slots + index * SlotSize);
+
+                        *tail = slot;
+                        tail = &slot->next;
+                    }
+                }
+
+                link = &page->next;
+            }
+
+            *tail = nullptr;
+        }
+
+        void Reserve(sizet size) override final
+        {
+            sizet freeCount = FreeCount();
+            if (size > freeCount)
+            {
+                ReserveMore(size - freeCount);
+            }
+        }
+
+        /// Adds a page with enough slots for \p{size} memory units.
+        void ReserveMore(sizet size) override final
+        {
+            if (size == 0) return;
+
+            if (_AddPage((size + SlotSize - 1) / SlotSize) == nullptr)
+            {
+                // todo: throw exception
+                // out of memory
+
+                return;
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Allocates a page with \p{slotCount} slots and adds its slots to the free list.
+        Page* _AddPage(sizet slotCount)
+        {
+            if (slotCount > (NPOS / 2) / SlotSize) return nullptr;
+
+            memptr mem = _allocator->AllocateRaw(_PageAllocSize(slotCount), false, SlotAlign);
+            if (mem == nullptr)
+            {
+                return nullptr;
+            }
+
+            Page* page = RCAST(Page*, mem);
+            page->next = _rootPage;
+            page->slotCount = slotCount;
+            _rootPage = page;
+
+            // link slots in address order, so that consecutive allocations are adjacent
+            memptr slots = _GetSlots(page);
+            for (sizet i = slotCount; i > 0; i--)
+            {
+                Slot* slot = RCAST(Slot*, slots + (i - 1) * SlotSize);
+                slot->next = _freeSlot;
+                _freeSlot = slot;
+            }
+
+            _slotCount += slotCount;
+            return page;
+        }
+
+        void _DeallocatePage(Page* page)
+        {
+            _allocator->DeallocateRaw(RCAST(memptr, page), _PageAllocSize(page->slotCount));
+        }
+
+        /// Count of slots of the next page added when the pool runs out of slots.
+        sizet _NextPageSlotCount() const noexcept
+        {
+            sizet maxCount = max(MaxPageSize / SlotSize, PageSlotCount);
+            return min(max(_slotCount, PageSlotCount), maxCount);
+        }
+
+        /// Are all slots of \p{page} marked free in its bitmap?
+        static bool _IsPageFree(Page* page) noexcept
+        {
+            sizet* bitmap = _GetBitmap(page);
+            sizet fullWordCount = page->slotCount / SizeTBitCount;
+            for (sizet i = 0; i < fullWordCount; i++)
+            {
+                if (bitmap[i] != NPOS) return false;
+            }
+
+            sizet restCount = page->slotCount % SizeTBitCount;
+            return restCount == 0 or bitmap[fullWordCount] == (SCAST(sizet, 1) << restCount) - 1;
+        }
+
+        static bool _HasSlot(Page* page, Slot* slot) noexcept
+        {
+            memptr slots = _GetSlots(page);
+            memptr mem = RCAST(memptr, slot);
+
+            return mem >= slots and mem < slots + page->slotCount * SlotSize;
+        }
+
+        static memptr _GetSlots(Page* page) noexcept
+        {
+            return RCAST(memptr, page) + _SlotsOffset(page->slotCount);
+        }
+
+        static sizet* _GetBitmap(Page* page) noexcept
+        {
+            return RCAST(sizet*, RCAST(memptr, page) + sizeof(Page));
+        }
+
+        static constexpr sizet _BitmapWordCount(sizet slotCount) noexcept
+        {
+            return (slotCount + SizeTBitCount - 1) / SizeTBitCount;
+        }
+
+        /// Offset of the first slot from the start of a page with \p{slotCount} slots.
+        static constexpr sizet _SlotsOffset(sizet slotCount) noexcept
+        {
+            return AlignUp(sizeof(Page) + _BitmapWordCount(slotCount) * sizeof(sizet), SlotAlign);
+        }
+
+        /// Count of memory units to allocate for a page with \p{slotCount} slots.
+        static constexpr sizet _PageAllocSize(sizet slotCount) noexcept
+        {
+            return _SlotsOffset(slotCount) + slotCount * SlotSize;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        IAllocator* _allocator;
+        Page* _rootPage = nullptr;
+        Slot* _freeSlot = nullptr;
+        sizet _slotCount = 0;
+        sizet _usedSlotCount = 0;
+        MemPoolCounters _counters;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/Core.hpp"
+
+namespace Atom
+{
+    /// Pointer which stores the offset of the object from itself, instead of its address.
+    /// 
+    /// As long as the pointer and the object move together, like inside an ArenaImage
+    /// written to disk and mapped back at another address, the pointer stays valid.
+    /// 
+    /// @tparam TypeT Pointer type.
+    /// 
+    /// @note The pointer cannot point to itself, offset 0 == used for null.
+    template <typename TypeT>
+    struct OffsetPtr
+    {
+    public:
+        /// Default constructor, creates a nullptr pointer.
+        OffsetPtr() noexcept:
+            _offset(0) { }
+
+        OffsetPtr(TypeT* ptr) noexcept
+        {
+            _Set(ptr);
+        }
+
+        /// Points to the same object as \p{other}, the offset == computed again.
+        OffsetPtr(const OffsetPtr& other) noexcept
+        {
+            _Set(other.Get());
+        }
+
+        OffsetPtr& operator = (const OffsetPtr& other) noexcept
+        {
+            _Set(other.Get());
+            return *this;
+        }
+
+        OffsetPtr& operator = (TypeT* ptr) noexcept
+        {
+            _Set(ptr);
+            return *this;
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Address of the object, computed from the address of this pointer.
+        TypeT* Get() const noexcept
+        {
+            return _offset == 0 ? nullptr : RCAST(TypeT*, RCAST(sizet, this) + _offset);
+        }
+
+        bool IsNull() const noexcept
+        {
+            return _offset == 0;
+        }
+
+        TypeT& operator * () const noexcept
+        {
+            return *Get();
+        }
+
+        TypeT* operator -> () const noexcept
+        {
+            return Get();
+        }
+
+        bool operator == (const OffsetPtr& other) const noexcept
+        {
+            return Get() == other.Get();
+        }
+
+        bool operator != (const OffsetPtr& other) const noexcept
+        {
+            return Get() != other.Get();
+        }
+
+    protected:
+        void _Set(TypeT* ptr) noexcept
+        {
+            // wraps around for objects before this pointer
+            _offset = ptr == nullptr ? 0 : RCAST(sizet, ptr) - RCAST(sizet, this);
+        }
+
+    protected:
+        /// Offset of the object from this pointer, 0 if null.
+        sizet _offset;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,441 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IAllocator.hpp"
+
+/// Set to 1 to wrap globalAllocator in a ProfilingAllocator, which writes its report
+/// at shutdown, see GlobalAllocation.cpp.
+#if !defined(ATOM_PROFILE_ALLOCATIONS)
+#define ATOM_PROFILE_ALLOCATIONS 0
+#endif
+
+namespace Atom
+{
+    /// Captures return addresses of the current call stack, innermost first.
+    ///
+    /// @param frames Array to write return addresses to.
+    /// @param count Max count of return addresses to capture.
+    /// @param skip Count of innermost frames to skip, this function itself == always skipped.
+    /// @return Count of return addresses written to \p{frames}.
+    ATOM_API sizet CaptureCallStack(void** frames, sizet count, sizet skip) noexcept;
+
+    /// ProfilingAllocator wraps another allocator and aggregates allocations by call site.
+    ///
+    /// A call site == the call stack of the allocation (captured up to \p{stackDepth} frames),
+    /// combined with the tag of the allocating thread, set using ProfilingAllocator::TagScope.
+    /// With \p{stackDepth == 0}, only tags are used, which avoids unwinding the stack.
+    /// For production builds, profile by tags or sample allocations, unsampled allocations
+    /// only pay for a header and a thread local counter. Counts, memory units and lifetimes
+    /// are aggregated per site in a fixed size lock-free hash table, so threads never wait
+    /// on each other.
+    ///
+    /// Each allocation carries a small header, which stores its site and time of allocation,
+    /// so memory must be deallocated through the same ProfilingAllocator.
+    ///
+    /// @note
+    /// - Only every \p{sampleInterval}-th allocation of a thread == recorded,
+    ///   counts in the report are of sampled allocations.
+    /// - A reallocation == recorded as a deallocation of the old memory and
+    ///   an allocation of the new memory at the call site of the reallocation.
+    class ProfilingAllocator: public virtual IAllocator
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Max count of frames stored for each call site.
+        static constexpr sizet MaxStackDepth = 16;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Sets the tag of allocations of the current thread, for the lifetime of the scope.
+        /// Scopes nest, the previous tag == restored on destruction.
+        class TagScope
+        {
+        public:
+            /// @param tag Name of the scope, must outlive the ProfilingAllocator,
+            ///     like a string literal.
+            TagScope(const char* tag) noexcept:
+                _prevTag(_tag)
+            {
+                _tag = tag;
+            }
+
+            TagScope(const TagScope& other) = delete;
+            TagScope& operator = (const TagScope& other) = delete;
+
+            ~TagScope()
+            {
+                _tag = _prevTag;
+            }
+
+        protected:
+            const char* _prevTag;
+        };
+
+        /// Statistics of a call site.
+        struct Site
+        {
+            /// Hash of the call site, 0 if the entry == empty.
+            std::atomic<sizet> hash{ 0 };
+
+            /// Set after \p{tag} and \p{frames} are written.
+            std::atomic<bool> isReady{ false };
+
+            /// Tag of the allocating thread, @nullptr if none.
+            const char* tag = nullptr;
+
+            /// Return addresses of the call stack, innermost first.
+            void* frames[MaxStackDepth] = { };
+            sizet frameCount = 0;
+
+            std::atomic<sizet> allocCount{ 0 };
+            std::atomic<sizet> allocBytes{ 0 };
+            std::atomic<sizet> deallocCount{ 0 };
+            std::atomic<sizet> deallocBytes{ 0 };
+
+            /// Sum and max of lifetimes of deallocated memory, in nanoseconds.
+            std::atomic<sizet> lifetimeSum{ 0 };
+            std::atomic<sizet> lifetimeMax{ 0 };
+        };
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Placed right before the memory handed to the user.
+        struct AllocHeader
+        {
+            /// Index of the Site object, NPOS if the allocation was not sampled.
+            sizet site;
+
+            /// Count of memory units between the backing memory and the user memory.
+            sizet offset;
+
+            /// Requested size.
+            sizet size;
+
+            /// Time of allocation, in nanoseconds.
+            sizet time;
+        };
+
+        /// Index of the Site object counting allocations which did not fit in the table.
+        static constexpr sizet OverflowSite = 0;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param backing Allocator to forward allocations to, must be thread safe
+        ///     if the ProfilingAllocator == used by many threads.
+        /// @param stackDepth Count of frames captured for each allocation, at most
+        ///     \p{MaxStackDepth}, 0 to profile by tags only.
+        /// @param sampleInterval Records one of every \p{sampleInterval} allocations of a thread.
+        /// @param siteCapacity Max count of distinct call sites, rounded up to a power of 2.
+        ProfilingAllocator(IAllocator& backing, sizet stackDepth = 8,
+            sizet sampleInterval = 1, sizet siteCapacity = 4096) noexcept:
+            _backing(&backing), _stackDepth(min(stackDepth, MaxStackDepth)),
+            _sampleInterval(max<sizet>(sampleInterval, 1))
+        {
+            _siteCapacity = 2;
+            while (_siteCapacity < siteCapacity) _siteCapacity *= 2;
+
+            _sites = _backing->ConstructMultiple<Site>(_siteCapacity);
+            if (_sites == nullptr)
+            {
+                _siteCapacity = 0;
+                return;
+            }
+
+            _sites[OverflowSite].hash = NPOS;
+            _sites[OverflowSite].tag = "[overflow]";
+            _sites[OverflowSite].isReady = true;
+        }
+
+        ProfilingAllocator(const ProfilingAllocator& other) = delete;
+        ProfilingAllocator& operator = (const ProfilingAllocator& other) = delete;
+
+        ~ProfilingAllocator()
+        {
+            _backing->Destruct(_sites, _siteCapacity);
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            return _Allocate(size, clear, align, _CaptureSite());
+        }
+
+        /// Captures the call site once for the whole batch, and allocates the batch
+        /// from the backing allocator at once.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
+        {
+            sizet offset = _GetOffset(align);
+            if (size == 0 or size > NPOS - offset)
+            {
+                return IAllocator::AllocateBatch(size, count, outPtrs, clear, align);
+            }
+
+            if (_backing->AllocateBatch(size + offset, count, outPtrs,
+                clear, max(align, DefaultAlign)) != true)
+            {
+                return false;
+            }
+
+            sizet site = _CaptureSite();
+            for (sizet i = 0; i < count; i++)
+            {
+                AllocHeader* header = RCAST(AllocHeader*, outPtrs[i] + offset) - 1;
+                header->offset = offset;
+                _InitHeader(header, site, size);
+
+                outPtrs[i] += offset;
+            }
+
+            return true;
+        }
+
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return _Allocate(size, clear, align, _CaptureSite());
+            }
+
+            if (size == 0)
+            {
+                DeallocateRaw(mem, 0);
+                return nullptr;
+            }
+
+            AllocHeader* header = _GetHeader(mem);
+            sizet offset = _GetOffset(align);
+            bool clearAllMem = clear and clearAll;
+            if (offset != header->offset or clearAllMem)
+            {
+                // header moves with the alignment, and the backing allocator would clear
+                // the header with the memory, so the memory moves
+                memptr newMem = _Allocate(size, clear, align, _CaptureSite());
+                if (newMem == nullptr) return nullptr;
+
+                if (clearAllMem != true)
+                {
+                    memcpy(newMem, mem, min(header->size, size));
+                }
+
+                DeallocateRaw(mem, header->size);
+                return newMem;
+            }
+
+            sizet oldSite = header->site;
+            sizet oldSize = header->size;
+            sizet oldTime = header->time;
+
+            memptr raw = _backing->ReallocateRaw(mem - offset, size + offset,
+                clear, false, max(align, DefaultAlign));
+            if (raw == nullptr) return nullptr;
+
+            _RecordDeallocate(oldSite, oldSize, oldTime);
+
+            header = RCAST(AllocHeader*, raw + offset) - 1;
+            _InitHeader(header, _CaptureSite(), size);
+            return raw + offset;
+        }
+
+        void DeallocateRaw(const memptr mem, sizet size) override final
+        {
+            if (mem == nullptr) return;
+
+            AllocHeader* header = _GetHeader(mem);
+            _RecordDeallocate(header->site, header->size, header->time);
+            _backing->DeallocateRaw(mem - header->offset, header->size + header->offset);
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of entries in the site table, some entries may be empty.
+        sizet SiteCapacity() const noexcept
+        {
+            return _siteCapacity;
+        }
+
+        /// Entry \p{index} of the site table, check \p{isReady} before reading it.
+        const Site& GetSite(sizet index) const noexcept
+        {
+            return _sites[index];
+        }
+
+        /// Writes call sites sorted by allocated memory units, one line per site
+        /// with counts, memory units, average and max lifetime, tag and frames.
+        ATOM_API void WriteReport(FILE* file) const;
+
+        /// Writes call sites in the folded stack format, \p{tag;outer;...;inner bytes},
+        /// which can be turned into a flame graph of allocated memory units.
+        ATOM_API void WriteFoldedStacks(FILE* file) const;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        memptr _Allocate(sizet size, bool clear, sizet align, sizet site)
+        {
+            if (size == 0) return nullptr;
+
+            sizet offset = _GetOffset(align);
+            if (size > NPOS - offset) return nullptr;
+
+            memptr raw = _backing->AllocateRaw(size + offset, clear, max(align, DefaultAlign));
+            if (raw == nullptr) return nullptr;
+
+            AllocHeader* header = RCAST(AllocHeader*, raw + offset) - 1;
+            header->offset = offset;
+            _InitHeader(header, site, size);
+
+            return raw + offset;
+        }
+
+        void _InitHeader(AllocHeader* header, sizet site, sizet size) noexcept
+        {
+            header->site = site;
+            header->size = size;
+            header->time = 0;
+
+            if (site != NPOS)
+            {
+                header->time = _GetTime();
+                _sites[site].allocCount.fetch_add(1, std::memory_order_relaxed);
+                _sites[site].allocBytes.fetch_add(size, std::memory_order_relaxed);
+            }
+        }
+
+        void _RecordDeallocate(sizet site, sizet size, sizet time) noexcept
+        {
+            if (site == NPOS) return;
+
+            Site& entry = _sites[site];
+            entry.deallocCount.fetch_add(1, std::memory_order_relaxed);
+            entry.deallocBytes.fetch_add(size, std::memory_order_relaxed);
+
+            sizet lifetime = _GetTime() - time;
+            entry.lifetimeSum.fetch_add(lifetime, std::memory_order_relaxed);
+
+            sizet lifetimeMax = entry.lifetimeMax.load(std::memory_order_relaxed);
+            while (lifetime > lifetimeMax and entry.lifetimeMax.compare_exchange_weak(
+                lifetimeMax, lifetime, std::memory_order_relaxed) != true) { }
+        }
+
+        /// Finds or adds the Site object of the current call site.
+        ///
+        /// @return Index of the Site object, NPOS if this allocation == not sampled.
+        sizet _CaptureSite() noexcept
+        {
+            if (_siteCapacity == 0) return NPOS;
+
+            if (_sampleCountdown > 0)
+            {
+                _sampleCountdown--;
+                return NPOS;
+            }
+
+            _sampleCountdown = _sampleInterval - 1;
+
+            void* frames[MaxStackDepth];
+            sizet frameCount = 0;
+            if (_stackDepth > 0)
+            {
+                // skips the allocation function of this allocator,
+                // this function == usually inlined into it
+                frameCount = CaptureCallStack(frames, _stackDepth, 1);
+            }
+
+            return _FindSite(_tag, frames, frameCount);
+        }
+
+        /// Finds or adds the Site object, using open addressing with linear probing.
+        /// Sites are never removed, so a claimed entry stays valid.
+        ///
+        /// @note Sites are compared by hash only, collisions of 64 bit hashes are ignored.
+        sizet _FindSite(const char* tag, void** frames, sizet frameCount) noexcept
+        {
+            sizet hash = _Hash(tag, frames, frameCount);
+            sizet mask = _siteCapacity - 1;
+
+            for (sizet i = 0; i < _siteCapacity; i++)
+            {
+                sizet index = (hash + i) & mask;
+                Site& site = _sites[index];
+
+                sizet siteHash = site.hash.load(std::memory_order_acquire);
+                if (siteHash == hash) return index;
+                if (siteHash != 0) continue;
+
+                if (site.hash.compare_exchange_strong(siteHash, hash, std::memory_order_acq_rel))
+                {
+                    site.tag = tag;
+                    site.frameCount = frameCount;
+                    memcpy(RCAST(memptr, site.frames), RCAST(memptr, frames), frameCount * sizeof(void*));
+                    site.isReady.store(true, std::memory_order_release);
+
+                    return index;
+                }
+
+                // another thread claimed this entry
+                if (siteHash == hash) return index;
+            }
+
+            return OverflowSite;
+        }
+
+        static sizet _Hash(const char* tag, void** frames, sizet frameCount) noexcept
+        {
+            // FNV-1a over the tag ptr and return addresses
+            sizet hash = SCAST(sizet, 14695981039346656037ull);
+            auto mix = [&hash](sizet value)
+            {
+                hash = (hash ^ value) * SCAST(sizet, 1099511628211ull);
+            };
+
+            mix(RCAST(sizet, tag));
+            for (sizet i = 0; i < frameCount; i++)
+            {
+                mix(RCAST(sizet, frames[i]));
+            }
+
+            // 0 marks empty entries, NPOS the overflow entry
+            return hash == 0 or hash == NPOS ? 1 : hash;
+        }
+
+        static AllocHeader* _GetHeader(memptr mem) noexcept
+        {
+            return RCAST(AllocHeader*, mem) - 1;
+        }
+
+        /// Count of memory units between the backing memory and the user memory,
+        /// keeps the user memory aligned to \p{align}.
+        static sizet _GetOffset(sizet align) noexcept
+        {
+            return AlignUp(sizeof(AllocHeader), max(align, DefaultAlign));
+        }
+
+        static sizet _GetTime() noexcept
+        {
+            return SCAST(sizet, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        IAllocator* _backing;
+        sizet _stackDepth;
+        sizet _sampleInterval;
+        sizet _siteCapacity;
+        Site* _sites;
+
+        /// Tag of allocations of this thread, set by TagScope.
+        static thread_local const char* _tag;
+
+        /// Count of allocations of this thread to skip before the next sampled one.
+        static thread_local sizet _sampleCountdown;
+    };
+
+    inline thread_local const char* ProfilingAllocator::_tag = nullptr;
+    inline thread_local sizet ProfilingAllocator::_sampleCountdown = 0;
+}
\ No newline at end of file
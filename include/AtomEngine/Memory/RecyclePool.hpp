@@ -0,0 +1,167 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/DefaultAllocator.hpp"
+#include "AtomEngine/Containers/DynamicArray.hpp"
+
+namespace Atom
+{
+    /// TRecyclePool keeps released objects constructed, and hands them out again on Acquire(),
+    /// for types which are expensive to construct, like ones owning DynamicArray buffers.
+    ///
+    /// A released object == Reset() and kept idle, so it keeps its internal buffers and
+    /// re-acquiring it needs neither construction nor any allocation. Objects released while
+    /// \p{Capacity()} objects are idle are destructed instead, so idle memory stays bounded.
+    ///
+    /// @tparam TypeT Type of objects, provides \p{void Reset()} which returns the object
+    ///     to the state of a newly constructed one, without releasing its buffers.
+    ///
+    /// @note
+    /// - Not thread safe, use a pool per thread.
+    /// - Objects must be released to the pool they were acquired from,
+    ///   before the pool == destructed.
+    template <typename TypeT>
+    class TRecyclePool
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Counters of the pool, returned by Stats().
+        struct Stats
+        {
+            /// Count of calls to Acquire().
+            sizet acquireCount = 0;
+
+            /// Count of calls to Acquire() served by an idle object.
+            sizet reuseCount = 0;
+
+            /// Count of calls to Release().
+            sizet releaseCount = 0;
+
+            /// Count of objects destructed on Release(), as the pool was full.
+            sizet discardCount = 0;
+
+            /// Count of objects acquired and not yet released.
+            sizet activeCount = 0;
+
+            /// Count of idle objects.
+            sizet idleCount = 0;
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param capacity Max count of idle objects.
+        /// @param allocator Allocator used to construct objects, must outlive the pool.
+        TRecyclePool(sizet capacity, IAllocator& allocator = DefaultAllocatorInstance):
+            _allocator(&allocator), _idle(allocator), _capacity(capacity)
+        {
+            _idle.Reserve(capacity);
+        }
+
+        TRecyclePool(const TRecyclePool& other) = delete;
+        TRecyclePool& operator = (const TRecyclePool& other) = delete;
+
+        ~TRecyclePool()
+        {
+            DEBUG_ASSERT(_stats.activeCount == 0, "TRecyclePool: objects are still acquired.");
+            Trim(0);
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Takes an idle object, or constructs a new one with \p{args} if none == idle.
+        ///
+        /// @return nullptr if a new object cannot be allocated.
+        ///
+        /// @note \p{args} are ignored for idle objects, which are in their Reset() state.
+        template <typename... ArgsT>
+        TypeT* Acquire(ArgsT&&... args)
+        {
+            TypeT* obj;
+            if (_idle.Count() > 0)
+            {
+                obj = _idle[_idle.Count() - 1];
+                _idle.RemoveBack();
+                _stats.reuseCount++;
+            }
+            else
+            {
+                obj = _allocator->Construct<TypeT>(forward<ArgsT>(args)...);
+                if (obj == nullptr) return nullptr;
+            }
+
+            _stats.acquireCount++;
+            _stats.activeCount++;
+            return obj;
+        }
+
+        /// Resets the object and keeps it idle, or destructs it if the pool == full.
+        void Release(TypeT* obj)
+        {
+            if (obj == nullptr) return;
+
+            _stats.releaseCount++;
+            _stats.activeCount--;
+
+            if (_idle.Count() < _capacity)
+            {
+                obj->Reset();
+                _idle.InsertBack(obj);
+            }
+            else
+            {
+                _stats.discardCount++;
+                _allocator->Destruct(obj);
+            }
+        }
+
+        /// Destructs idle objects, until at most \p{count} are left.
+        void Trim(sizet count)
+        {
+            while (_idle.Count() > count)
+            {
+                _allocator->Destruct(_idle[_idle.Count() - 1]);
+                _idle.RemoveBack();
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Max count of idle objects.
+        sizet Capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        /// Sets max count of idle objects, destructs idle objects above it.
+        void SetCapacity(sizet capacity)
+        {
+            _capacity = capacity;
+            Trim(capacity);
+            _idle.Reserve(capacity - _idle.Count());
+        }
+
+        Stats GetStats() const noexcept
+        {
+            Stats stats = _stats;
+            stats.idleCount = _idle.Count();
+            return stats;
+        }
+
+        /// Resets counters of GetStats(), counts of objects are kept.
+        void ResetStats() noexcept
+        {
+            sizet activeCount = _stats.activeCount;
+            _stats = Stats();
+            _stats.activeCount = activeCount;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        IAllocator* _allocator;
+
+        /// Idle objects, space for \p{_capacity} entries == reserved up front.
+        DynamicArray<TypeT*> _idle;
+        sizet _capacity;
+        Stats _stats;
+    };
+}
\ No newline at end of file
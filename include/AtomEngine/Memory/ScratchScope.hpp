@@ -0,0 +1,138 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/StackAllocator.hpp"
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+
+namespace Atom
+{
+    /// ScratchScope hands out temporary memory of the current thread, and frees all of it
+    /// when the scope ends.
+    ///
+    /// Each thread owns \p{ArenaCount} StackAllocator arenas, reserved on first use.
+    /// A scope takes a marker of an arena and frees to it on destruction, so scopes nest
+    /// and allocation == a pointer bump without any lock.
+    ///
+    /// A function which returns results allocated by its caller's scratch allocator, must not
+    /// open its own scope on the same arena, as its rollback would free the results allocated
+    /// after its marker. So the caller's allocator == passed as \p{conflict}, and the scope
+    /// takes another arena.
+    ///
+    /// @example
+    /// ```
+    /// void BuildNames(IAllocator& out)
+    /// {
+    ///     ScratchScope scratch(&out);
+    ///     DynamicArray<int> tmp(scratch.Allocator());
+    ///     ...
+    /// }
+    /// ```
+    ///
+    /// @note
+    /// - Scopes must end in reverse order of their construction on each arena.
+    /// - Memory must not be passed to other threads after the scope ends.
+    class ScratchScope
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of arenas of each thread.
+        static constexpr sizet ArenaCount = 2;
+
+        /// Count of memory units of address space reserved for each arena,
+        /// pages are backed by memory only when first touched.
+        static constexpr sizet ArenaSize = 16 * 1024 * 1024;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Arenas of a thread, released when the thread exits.
+        struct ThreadArenas
+        {
+            StackAllocator arenas[ArenaCount];
+
+            /// Reserved range of each arena, nullptr until the arena == first used.
+            memptr mems[ArenaCount] = { };
+
+            ~ThreadArenas()
+            {
+                for (memptr mem : mems)
+                {
+                    if (mem != nullptr)
+                    {
+                        ReleaseVirtualMemory(mem, ArenaSize);
+                    }
+                }
+            }
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Opens a scope on an arena of the current thread.
+        ///
+        /// @param conflict Allocator in use by the caller, the scope takes an arena other than it.
+        ScratchScope(const IAllocator* conflict = nullptr) noexcept
+        {
+            ThreadArenas& thread = _threadArenas;
+            sizet index = 0;
+            while (index + 1 < ArenaCount and &thread.arenas[index] == conflict)
+            {
+                index++;
+            }
+
+            if (thread.mems[index] == nullptr)
+            {
+                _Reserve(thread, index);
+            }
+
+            _arena = &thread.arenas[index];
+            _marker = _arena->GetMarker();
+        }
+
+        ScratchScope(const ScratchScope& other) = delete;
+        ScratchScope& operator = (const ScratchScope& other) = delete;
+
+        /// Frees all memory allocated from the arena since the scope was opened.
+        ~ScratchScope()
+        {
+            _arena->FreeToMarker(_marker);
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Allocator of the arena, to pass to containers.
+        StackAllocator& Allocator() noexcept
+        {
+            return *_arena;
+        }
+
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) noexcept
+        {
+            return _arena->AllocateRaw(size, clear, align);
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Reserves the range of the arena, which stays empty if out of address space.
+        static void _Reserve(ThreadArenas& thread, sizet index) noexcept
+        {
+            memptr mem = ReserveVirtualMemory(ArenaSize, GetPageSize());
+            if (mem == nullptr) return;
+
+            if (CommitVirtualMemory(mem, ArenaSize, false) != true)
+            {
+                ReleaseVirtualMemory(mem, ArenaSize);
+                return;
+            }
+
+            thread.arenas[index] = StackAllocator(mem, ArenaSize);
+            thread.mems[index] = mem;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        StackAllocator* _arena;
+        StackAllocator::Marker _marker;
+
+        static thread_local ThreadArenas _threadArenas;
+    };
+
+    inline thread_local ScratchScope::ThreadArenas ScratchScope::_threadArenas;
+}
\ No newline at end of file
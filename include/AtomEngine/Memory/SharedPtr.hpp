@@ -2,20 +2,26 @@
 #include "AtomEngine/Core.hpp"
 #include "AtomEngine/Memory/Ptr.hpp"
 #include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
 
 namespace Atom
 {
-    template <typename TypeT>
+    /// @tparam TypeT Pointer type.
+    /// @tparam AllocatorPolicyT Policy used to reach the allocator, see AllocatorPolicy.hpp.
+    template <typename TypeT, typename AllocatorPolicyT = PolymorphicAllocatorPolicy>
     struct TSharedPtr: public TPtr<TypeT>
     {
-        using ThisT = TSharedPtr<TypeT>;
+        using ThisT = TSharedPtr<TypeT, AllocatorPolicyT>;
         using BaseT = TPtr<TypeT>;
 
     protected:
+        /// Control block shared by all TSharedPtr objects referencing the same object,
+        /// always allocated from DefaultAllocatorInstance, so that \p{allocator}
+        /// needs to manage memory for TypeT only.
         struct SharedData
         {
-            SizeT count = 0;
-            IAllocator& allocator = DefaultAllocatorInstance;
+            SizeT count;
+            AllocatorPolicyT allocator;
         };
 
     public:
@@ -34,7 +40,7 @@ namespace Atom
         }
 
         TSharedPtr(TSharedPtr&& other) noexcept:
-            BaseT(move(other))
+            BaseT(nullptr)
         {
             _Swap(other);
         }
@@ -49,23 +55,21 @@ namespace Atom
 
         ThisT& operator = (ThisT&& other) noexcept
         {
-            ThisT tmp = other;
+            ThisT tmp = move(other);
             _Swap(tmp);
 
             return *this;
         }
 
         TSharedPtr(TypeT* inPtr) noexcept:
-            ThisT(inPtr, DefaultAllocatorInstance) { }
+            ThisT(inPtr, AllocatorPolicyT()) { }
 
-        TSharedPtr(TypeT* inPtr, IAllocator& allocator) noexcept:
+        TSharedPtr(TypeT* inPtr, AllocatorPolicyT allocator) noexcept:
             BaseT(inPtr)
         {
             if (inPtr != nullptr)
             {
-                _sharedData = allocator.Construct<SharedData>();
-                _sharedData->allocator = allocator;
-                _sharedData->count = 0;
+                _sharedData = DefaultAllocatorInstance.Construct<SharedData>(SharedData{ 1, allocator });
             }
         }
 
@@ -84,7 +88,7 @@ namespace Atom
                 if (_sharedData->count == 0)
                 {
                     _sharedData->allocator.Destruct(_ptr);
-                    _sharedData->allocator.Destruct(_sharedData);
+                    DefaultAllocatorInstance.Destruct(_sharedData);
                 }
             }
         };
@@ -105,8 +109,9 @@ namespace Atom
         template <typename... ArgsT>
         static ThisT Create(ArgsT... args)
         {
-            TypeT* obj = DefaultAllocatorInstance.Construct(forward<ArgsT>(args)...);
-            return ThisT(obj, DefaultAllocatorInstance);
+            AllocatorPolicyT allocator;
+            TypeT* obj = allocator.template Construct<TypeT>(forward<ArgsT>(args)...);
+            return ThisT(obj, allocator);
         }
 
     public:
@@ -121,6 +126,6 @@ namespace Atom
     protected:
         using BaseT::_ptr;
 
-        SharedData* _sharedData;
+        SharedData* _sharedData = nullptr;
     };
 }
\ No newline at end of file
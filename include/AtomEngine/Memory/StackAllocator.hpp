@@ -0,0 +1,68 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+
+namespace Atom
+{
+    /// StackAllocator == a LinearAllocator which frees memory in LIFO order.
+    /// 
+    /// GetMarker() saves the top of the stack, FreeToMarker() frees everything
+    /// allocated after the marker was taken, so nested scopes can roll back
+    /// all their allocations at once.
+    /// 
+    /// @note DeallocateRaw() frees memory only if it == at the top of the stack.
+    ///     Pass the size of the allocation, so that memory below the last allocation
+    ///     can be popped too, like blocks of a batch deallocated in reverse order.
+    class StackAllocator: public LinearAllocator
+    {
+        using BaseT = LinearAllocator;
+
+    public:
+        /// Saved top of the stack.
+        using Marker = sizet;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        using BaseT::BaseT;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Returns the current top of the stack.
+        Marker GetMarker() const noexcept
+        {
+            return _offset;
+        }
+
+        /// Frees all memory allocated after \p{marker} was taken.
+        /// 
+        /// @param marker Marker returned by GetMarker(), must not be above the current top.
+        void FreeToMarker(Marker marker) noexcept
+        {
+            DEBUG_ASSERT(marker <= _offset, "StackAllocator: marker == above the top of the stack.");
+
+            _offset = marker;
+            _last = nullptr;
+        }
+
+        /// Frees \p{mem} if it == at the top of the stack, does nothing otherwise.
+        ///
+        /// @param size Size of the allocation, or 0 if unknown, in which case only
+        ///     the last allocation == freed. The top of the stack == found from it,
+        ///     the memory == freed up to the offset stored in the header of \p{mem}.
+        void DeallocateRaw(memptr mem, sizet size) override final
+        {
+            if (mem == nullptr or mem < _mem or mem >= _mem + _offset) return;
+
+            sizet offset = mem - _mem;
+            bool isTop = mem == _last or (size > 0 and size <= _size - offset
+                and min(offset + AlignUp(size, Align), _size) == _offset);
+
+            if (isTop)
+            {
+                Marker marker = _GetHeader(mem)->offset;
+                _counters.OnDeallocate(_offset - marker);
+                FreeToMarker(marker);
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -1,13 +1,13 @@
 #pragma once
 #include "AtomEngine/Core.hpp"
-#include "AtomEngine/Memory/FastLinkedMemPool.hpp"
+#include "AtomEngine/Memory/LinkedMemPool.hpp"
 
 namespace Atom
 {
-    template<sizet StackSize, sizet TBlockStackSize = (StackSize / 2)>
-    class StackMemPool: public virtual FastLinkedMemPool<TBlockStackSize>
+    template<sizet StackSize>
+    class StackMemPool: public virtual LinkedMemPool
     {
-        using BaseT = FastLinkedMemPool<TBlockStackSize>;
+        using BaseT = LinkedMemPool;
 
     public:
         StackMemPool() noexcept
@@ -0,0 +1,739 @@
+#pragma once
+#include <mutex>
+
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/IAllocator.hpp"
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+
+namespace Atom
+{
+    /// ThreadCacheAllocator == a thread safe front end for another allocator.
+    /// 
+    /// Small allocations are served from per thread caches, one list of free blocks
+    /// for each size class, without any locking. Caches are refilled from and drained to
+    /// per size class central lists in batches, central lists take memory in spans of
+    /// many blocks, from a range of address space reserved for small blocks.
+    /// 
+    /// Small blocks have no header, all blocks of a span have the same size class,
+    /// stored at the start of the span. Spans are aligned to their size, so the size class
+    /// of a block == found by rounding its address down. DeallocateRaw() always takes
+    /// the size class from the span, a single load of memory which == usually hot, so a wrong
+    /// size passed by the caller never puts a block on the list of another size class.
+    /// Whether a block == small, == decided by its address alone.
+    /// 
+    /// Blocks freed by a thread other than the one which allocated them go to the cache
+    /// of the freeing thread, and return to the central lists when that cache drains.
+    /// 
+    /// Large allocations are forwarded to the backend allocator under a lock,
+    /// as are small allocations once the reserved range == used up.
+    /// 
+    /// @note
+    /// - Memory of small blocks == released only when the ThreadCacheAllocator == destroyed.
+    /// - Size passed to DeallocateRaw() must be 0 or the size passed to the last
+    ///   AllocateRaw() or ReallocateRaw() of the block, like sized operator delete.
+    class ThreadCacheAllocator: public virtual IAllocator
+    {
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Size of header placed before each large block and at the start of each span,
+        /// keeps blocks aligned to max_align_t.
+        static constexpr sizet HeaderSize = alignof(std::max_align_t);
+
+        /// Difference between sizes of consecutive size classes.
+        static constexpr sizet SizeClassStep = 16;
+
+        /// Count of size classes served from thread caches.
+        static constexpr sizet SizeClassCount = 64;
+
+        /// Largest size served from thread caches.
+        static constexpr sizet MaxCachedSize = SizeClassStep * SizeClassCount;
+
+        /// Count of blocks moved between a thread cache and a central list at once.
+        static constexpr sizet BatchCount = 32;
+
+        /// Count of blocks a thread cache keeps for each size class before draining.
+        static constexpr sizet MaxCacheCount = BatchCount * 2;
+
+        /// Count of memory units in a span of small blocks, also the alignment of spans.
+        static constexpr sizet SpanSize = 64 * 1024;
+
+        /// Count of memory units committed at once in the range reserved for spans.
+        static constexpr sizet SpanCommitSize = 16 * SpanSize;
+
+        /// Default count of memory units of address space reserved for spans.
+        static constexpr sizet DefaultSmallReserveSize = sizeof(void*) >= 8 ?
+            SCAST(sizet, 16) * 1024 * 1024 * 1024 : SCAST(sizet, 256) * 1024 * 1024;
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Header placed before each large block.
+        struct LargeHeader
+        {
+            /// Count of memory units between the backend memory and the block, which
+            /// == more than \p{HeaderSize} for blocks aligned more than \p{HeaderSize}.
+            sizet offset;
+
+            /// Count of usable memory units in the block.
+            sizet size;
+        };
+
+        SASSERT(sizeof(LargeHeader) <= HeaderSize);
+
+        /// Free block, linked with other free blocks of the same size class.
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        /// List of free blocks of one size class.
+        struct BlockList
+        {
+            FreeBlock* head = nullptr;
+            sizet count = 0;
+        };
+
+        /// Central list of free blocks of one size class, shared by all threads.
+        struct CentralList
+        {
+            std::mutex lock;
+            FreeBlock* head = nullptr;
+        };
+
+        /// Header at the start of each span of small blocks.
+        struct Span
+        {
+            sizet sizeClass;
+        };
+
+        SASSERT(sizeof(Span) <= HeaderSize);
+
+        /// Cache of free blocks owned by a single thread.
+        struct ThreadCache
+        {
+            /// nullptr if the allocator has been destroyed.
+            ThreadCacheAllocator* owner = nullptr;
+            ThreadCache* nextInOwner = nullptr;
+            ThreadCache* nextInThread = nullptr;
+            BlockList lists[SizeClassCount];
+        };
+
+        /// Thread caches of the current thread, one for each allocator used by the thread.
+        struct ThreadState
+        {
+            ThreadCache* caches = nullptr;
+            bool exited = false;
+        };
+
+        /// Releases thread caches when the thread exits.
+        struct ThreadCleaner
+        {
+            void Register() noexcept { }
+
+            ~ThreadCleaner()
+            {
+                ThreadState& state = _threadState;
+                state.exited = true;
+
+                std::lock_guard<std::mutex> guard(_GetRegistryLock());
+                while (state.caches != nullptr)
+                {
+                    ThreadCache* cache = state.caches;
+                    state.caches = cache->nextInThread;
+
+                    if (cache->owner != nullptr)
+                    {
+                        cache->owner->_ReleaseCache(cache);
+                    }
+
+                    delete cache;
+                }
+            }
+        };
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param backend Allocator used to allocate large blocks.
+        /// @param smallReserveSize Count of memory units of address space reserved for spans
+        ///     of small blocks, committed as needed.
+        ThreadCacheAllocator(IAllocator& backend,
+            sizet smallReserveSize = DefaultSmallReserveSize) noexcept:
+            _backend(&backend)
+        {
+            // without the reserved range, every block == allocated as a large block
+            smallReserveSize = AlignDown(smallReserveSize, SpanCommitSize);
+            if (smallReserveSize > 0 and SpanSize % GetPageSize() == 0)
+            {
+                _smallMem = ReserveVirtualMemory(smallReserveSize, SpanSize);
+                _smallReserveSize = _smallMem != nullptr ? smallReserveSize : 0;
+            }
+        }
+
+        ThreadCacheAllocator(const ThreadCacheAllocator& other) = delete;
+        ThreadCacheAllocator& operator = (const ThreadCacheAllocator& other) = delete;
+
+        ~ThreadCacheAllocator()
+        {
+            {
+                std::lock_guard<std::mutex> guard(_GetRegistryLock());
+                for (ThreadCache* cache = _caches; cache != nullptr; cache = cache->nextInOwner)
+                {
+                    cache->owner = nullptr;
+                }
+            }
+
+            if (_smallMem != nullptr)
+            {
+                ReleaseVirtualMemory(_smallMem, _smallReserveSize);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @note Blocks aligned more than \p{HeaderSize} are allocated from the backend allocator.
+        memptr AllocateRaw(sizet size, bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (size == 0) return nullptr;
+
+            if (size > MaxCachedSize or align > HeaderSize)
+            {
+                return _AllocateLarge(size, clear, align);
+            }
+
+            sizet sizeClass = _MapSizeClass(size);
+            memptr mem = _AllocateSmall(sizeClass);
+            if (mem == nullptr)
+            {
+                return _AllocateLarge(size, clear, align);
+            }
+
+            if (clear)
+            {
+                memset(mem, 0, _GetSizeClassSize(sizeClass));
+            }
+
+            return mem;
+        }
+
+        memptr ReallocateRaw(const memptr mem, sizet size, bool clear = true,
+            bool clearAll = false, sizet align = DefaultAlign) override final
+        {
+            if (mem == nullptr)
+            {
+                return AllocateRaw(size, clear, align);
+            }
+
+            if (size == 0)
+            {
+                DeallocateRaw(mem, 0);
+                return nullptr;
+            }
+
+            bool isSmall = _IsSmall(mem);
+            if (isSmall != true)
+            {
+                // large blocks keep their offset from the backend memory, and so their alignment
+                if (align <= _GetLargeHeader(mem)->offset)
+                {
+                    return _ReallocateLarge(mem, size, clear, clearAll);
+                }
+            }
+
+            // small blocks stay in place only if the size class stays the same,
+            // so that sized deallocation finds the size class from the new size.
+            // They are cleared up to their size class on allocation,
+            // so only the part after the requested size needs to be cleared.
+            sizet blockSize = _GetBlockSize(mem);
+            if (isSmall and size <= MaxCachedSize and align <= HeaderSize
+                and _MapSizeClass(size) == _GetSpan(mem)->sizeClass)
+            {
+                if (clear)
+                {
+                    sizet offset = clearAll ? 0 : size;
+                    memset(mem + offset, 0, blockSize - offset);
+                }
+
+                return mem;
+            }
+
+            memptr newMem = AllocateRaw(size, false, align);
+            if (newMem == nullptr)
+            {
+                return nullptr;
+            }
+
+            sizet copySize = min(blockSize, size);
+            memcpy(newMem, mem, copySize);
+            if (clear)
+            {
+                sizet offset = clearAll ? 0 : copySize;
+                memset(newMem + offset, 0, _GetBlockSize(newMem) - offset);
+            }
+
+            DeallocateRaw(mem, blockSize);
+            return newMem;
+        }
+
+        /// @param size Size of the block, or 0 if unknown. The size class == read from the span
+        ///     of the block, \p{size} == only checked against it in debug builds.
+        void DeallocateRaw(memptr mem, sizet size) override final
+        {
+            if (mem == nullptr) return;
+
+            if (_IsSmall(mem) != true)
+            {
+                _DeallocateLarge(mem);
+                return;
+            }
+
+            sizet sizeClass = _GetSpan(mem)->sizeClass;
+
+            DEBUG_ASSERT(size == 0 or size > MaxCachedSize or _MapSizeClass(size) == sizeClass,
+                "ThreadCacheAllocator: size does not match the size of the block.");
+
+            FreeBlock* block = RCAST(FreeBlock*, mem);
+            ThreadCache* cache = _GetThreadCache();
+            if (cache == nullptr)
+            {
+                BlockList list;
+                list.head = block;
+                list.count = 1;
+                block->next = nullptr;
+
+                _Drain(sizeClass, list, 1);
+                return;
+            }
+
+            BlockList& list = cache->lists[sizeClass];
+            block->next = list.head;
+            list.head = block;
+            list.count++;
+
+            if (list.count > MaxCacheCount)
+            {
+                _Drain(sizeClass, list, BatchCount);
+            }
+        }
+
+        /// Pops small blocks off the thread cache, refilling it with the whole rest
+        /// of the batch at once, so the central list == locked once per batch.
+        bool AllocateBatch(sizet size, sizet count, memptr* outPtrs,
+            bool clear = true, sizet align = DefaultAlign) override final
+        {
+            if (size == 0 or size > MaxCachedSize or align > HeaderSize)
+            {
+                return IAllocator::AllocateBatch(size, count, outPtrs, clear, align);
+            }
+
+            sizet sizeClass = _MapSizeClass(size);
+            ThreadCache* cache = _GetThreadCache();
+            BlockList threadExitList;
+            BlockList& list = cache != nullptr ? cache->lists[sizeClass] : threadExitList;
+
+            sizet i = 0;
+            for (; i < count; i++)
+            {
+                if (list.head == nullptr)
+                {
+                    _Refill(sizeClass, list, max(count - i, BatchCount));
+                    if (list.head == nullptr) break;
+                }
+
+                FreeBlock* block = list.head;
+                list.head = block->next;
+                list.count--;
+
+                outPtrs[i] = RCAST(memptr, block);
+                if (clear)
+                {
+                    memset(outPtrs[i], 0, _GetSizeClassSize(sizeClass));
+                }
+            }
+
+            if (cache == nullptr and list.head != nullptr)
+            {
+                _Drain(sizeClass, list, list.count);
+            }
+
+            // reserved range == used up, the rest comes from the backend
+            for (; i < count; i++)
+            {
+                outPtrs[i] = _AllocateLarge(size, clear, align);
+                if (outPtrs[i] == nullptr)
+                {
+                    DeallocateBatch(outPtrs, i, size);
+                    memset(RCAST(memptr, outPtrs), 0, count * sizeof(memptr));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// Pushes small blocks onto the thread cache, and drains each list to the central list
+        /// at most once per batch.
+        /// 
+        /// @param size Size of every block, or 0 if unknown. Size classes are read from spans
+        ///     of the blocks, \p{size} == only checked against them in debug builds.
+        void DeallocateBatch(memptr* ptrs, sizet count, sizet size = 0) override final
+        {
+            ThreadCache* cache = _GetThreadCache();
+            if (cache == nullptr)
+            {
+                IAllocator::DeallocateBatch(ptrs, count, size);
+                return;
+            }
+
+            sizet lastClass = NPOS;
+            for (sizet i = count; i > 0; i--)
+            {
+                memptr mem = ptrs[i - 1];
+                if (mem == nullptr) continue;
+
+                if (_IsSmall(mem) != true)
+                {
+                    _DeallocateLarge(mem);
+                    continue;
+                }
+
+                sizet sizeClass = _GetSpan(mem)->sizeClass;
+                DEBUG_ASSERT(size == 0 or size > MaxCachedSize or _MapSizeClass(size) == sizeClass,
+                    "ThreadCacheAllocator: size does not match the size of the block.");
+
+                // blocks of a batch usually share the size class, its list drains once
+                if (sizeClass != lastClass and lastClass != NPOS)
+                {
+                    _DrainExcess(lastClass, cache->lists[lastClass]);
+                }
+
+                FreeBlock* block = RCAST(FreeBlock*, mem);
+                BlockList& list = cache->lists[sizeClass];
+                block->next = list.head;
+                list.head = block;
+                list.count++;
+                lastClass = sizeClass;
+            }
+
+            if (lastClass != NPOS)
+            {
+                _DrainExcess(lastClass, cache->lists[lastClass]);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Drains the list down to below \p{MaxCacheCount}, if it grew above it.
+        void _DrainExcess(sizet sizeClass, BlockList& list)
+        {
+            if (list.count > MaxCacheCount)
+            {
+                _Drain(sizeClass, list, list.count - MaxCacheCount + BatchCount);
+            }
+        }
+
+        memptr _AllocateSmall(sizet sizeClass)
+        {
+            ThreadCache* cache = _GetThreadCache();
+            if (cache == nullptr)
+            {
+                BlockList list;
+                _Refill(sizeClass, list, 1);
+
+                return RCAST(memptr, list.head);
+            }
+
+            BlockList& list = cache->lists[sizeClass];
+            if (list.head == nullptr)
+            {
+                _Refill(sizeClass, list, BatchCount);
+
+                if (list.head == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            FreeBlock* block = list.head;
+            list.head = block->next;
+            list.count--;
+
+            return RCAST(memptr, block);
+        }
+
+        /// Moves up to \p{count} blocks from the central list to \p{list}.
+        void _Refill(sizet sizeClass, BlockList& list, sizet count)
+        {
+            CentralList& central = _centralLists[sizeClass];
+            std::lock_guard<std::mutex> guard(central.lock);
+
+            if (central.head == nullptr)
+            {
+                central.head = _AllocateSpan(sizeClass);
+            }
+
+            while (central.head != nullptr and count > 0)
+            {
+                FreeBlock* block = central.head;
+                central.head = block->next;
+
+                block->next = list.head;
+                list.head = block;
+                list.count++;
+                count--;
+            }
+        }
+
+        /// Moves \p{count} blocks from \p{list} to the central list.
+        void _Drain(sizet sizeClass, BlockList& list, sizet count)
+        {
+            FreeBlock* first = list.head;
+            FreeBlock* last = first;
+            for (sizet i = 1; i < count; i++)
+            {
+                last = last->next;
+            }
+
+            list.head = last->next;
+            list.count -= count;
+
+            CentralList& central = _centralLists[sizeClass];
+            std::lock_guard<std::mutex> guard(central.lock);
+
+            last->next = central.head;
+            central.head = first;
+        }
+
+        /// Takes a span from the reserved range and divides it into blocks of
+        /// size class \p{sizeClass}.
+        /// 
+        /// @return List of blocks in the span, nullptr if the reserved range == used up.
+        FreeBlock* _AllocateSpan(sizet sizeClass)
+        {
+            memptr mem;
+            {
+                std::lock_guard<std::mutex> guard(_spanLock);
+                if (_smallUsed == _smallCommitted)
+                {
+                    if (_smallCommitted == _smallReserveSize or CommitVirtualMemory(
+                        _smallMem + _smallCommitted, SpanCommitSize, false) != true)
+                    {
+                        return nullptr;
+                    }
+
+                    _smallCommitted += SpanCommitSize;
+                }
+
+                mem = _smallMem + _smallUsed;
+                _smallUsed += SpanSize;
+            }
+
+            RCAST(Span*, mem)->sizeClass = sizeClass;
+
+            sizet stride = _GetSizeClassSize(sizeClass);
+            sizet count = (SpanSize - HeaderSize) / stride;
+
+            FreeBlock* head = nullptr;
+            for (sizet i = count; i > 0; i--)
+            {
+                FreeBlock* block = RCAST(FreeBlock*, mem + HeaderSize + (i - 1) * stride);
+                block->next = head;
+                head = block;
+            }
+
+            return head;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        memptr _AllocateLarge(sizet size, bool clear, sizet align)
+        {
+            // backend memory == aligned to align, so the block stays aligned after the offset
+            sizet offset = max(HeaderSize, align);
+            if (size > NPOS - offset) return nullptr;
+
+            // the backend clears, so it can skip memory known to read 0
+            memptr mem;
+            {
+                std::lock_guard<std::mutex> guard(_backendLock);
+                mem = _backend->AllocateRaw(offset + size, clear, align);
+            }
+
+            if (mem == nullptr)
+            {
+                return nullptr;
+            }
+
+            mem += offset;
+            _GetLargeHeader(mem)->offset = offset;
+            _GetLargeHeader(mem)->size = size;
+
+            return mem;
+        }
+
+        memptr _ReallocateLarge(memptr mem, sizet size, bool clear, bool clearAll)
+        {
+            sizet offset = _GetLargeHeader(mem)->offset;
+            if (size > NPOS - offset) return nullptr;
+
+            sizet oldSize = _GetLargeHeader(mem)->size;
+            memptr newMem;
+            {
+                std::lock_guard<std::mutex> guard(_backendLock);
+                newMem = _backend->ReallocateRaw(mem - offset, offset + size, false, false, offset);
+            }
+
+            if (newMem == nullptr)
+            {
+                return nullptr;
+            }
+
+            newMem += offset;
+            _GetLargeHeader(newMem)->size = size;
+
+            if (clear)
+            {
+                sizet offset = clearAll ? 0 : min(oldSize, size);
+                memset(newMem + offset, 0, size - offset);
+            }
+
+            return newMem;
+        }
+
+        void _DeallocateLarge(memptr mem)
+        {
+            std::lock_guard<std::mutex> guard(_backendLock);
+            sizet offset = _GetLargeHeader(mem)->offset;
+            _backend->DeallocateRaw(mem - offset, offset + _GetLargeHeader(mem)->size);
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Finds cache of the current thread for this allocator, creates one if not found.
+        /// 
+        /// @return nullptr if the current thread == exiting.
+        ThreadCache* _GetThreadCache()
+        {
+            ThreadState& state = _threadState;
+            for (ThreadCache* cache = state.caches; cache != nullptr; cache = cache->nextInThread)
+            {
+                if (cache->owner == this)
+                {
+                    return cache;
+                }
+            }
+
+            if (state.exited)
+            {
+                return nullptr;
+            }
+
+            return _CreateThreadCache(state);
+        }
+
+        ThreadCache* _CreateThreadCache(ThreadState& state)
+        {
+            _threadCleaner.Register();
+
+            ThreadCache* cache = new ThreadCache();
+            cache->owner = this;
+            cache->nextInThread = state.caches;
+            state.caches = cache;
+
+            std::lock_guard<std::mutex> guard(_GetRegistryLock());
+            cache->nextInOwner = _caches;
+            _caches = cache;
+
+            return cache;
+        }
+
+        /// Drains all blocks of \p{cache} and unlinks it from this allocator.
+        /// 
+        /// @note Registry lock must be held by the caller.
+        void _ReleaseCache(ThreadCache* cache)
+        {
+            for (sizet sizeClass = 0; sizeClass < SizeClassCount; sizeClass++)
+            {
+                BlockList& list = cache->lists[sizeClass];
+                if (list.count > 0)
+                {
+                    _Drain(sizeClass, list, list.count);
+                }
+            }
+
+            ThreadCache** link = &_caches;
+            while (*link != cache)
+            {
+                link = &(*link)->nextInOwner;
+            }
+
+            *link = cache->nextInOwner;
+            cache->owner = nullptr;
+        }
+
+        /// Lock guarding links between allocators and thread caches.
+        static std::mutex& _GetRegistryLock()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        static constexpr sizet _MapSizeClass(sizet size) noexcept
+        {
+            return (size - 1) / SizeClassStep;
+        }
+
+        static constexpr sizet _GetSizeClassSize(sizet sizeClass) noexcept
+        {
+            return (sizeClass + 1) * SizeClassStep;
+        }
+
+        static LargeHeader* _GetLargeHeader(memptr mem) noexcept
+        {
+            return RCAST(LargeHeader*, mem - HeaderSize);
+        }
+
+        /// Is \p{mem} a small block, placed in the range reserved for spans?
+        bool _IsSmall(memptr mem) const noexcept
+        {
+            return RCAST(sizet, mem) - RCAST(sizet, _smallMem) < _smallReserveSize;
+        }
+
+        /// Span containing the small block.
+        Span* _GetSpan(memptr mem) const noexcept
+        {
+            return RCAST(Span*, AlignDown(RCAST(sizet, mem), SpanSize));
+        }
+
+        /// Count of usable memory units in the block.
+        sizet _GetBlockSize(memptr mem) const noexcept
+        {
+            if (_IsSmall(mem))
+            {
+                return _GetSizeClassSize(_GetSpan(mem)->sizeClass);
+            }
+
+            return _GetLargeHeader(mem)->size;
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        IAllocator* _backend;
+        std::mutex _backendLock;
+        CentralList _centralLists[SizeClassCount];
+        std::mutex _spanLock;
+
+        /// Range reserved for spans of small blocks, aligned to \p{SpanSize}.
+        memptr _smallMem = nullptr;
+        sizet _smallReserveSize = 0;
+        sizet _smallCommitted = 0;
+        sizet _smallUsed = 0;
+        ThreadCache* _caches = nullptr;
+
+        static thread_local ThreadState _threadState;
+        static thread_local ThreadCleaner _threadCleaner;
+    };
+
+    inline thread_local ThreadCacheAllocator::ThreadState ThreadCacheAllocator::_threadState;
+    inline thread_local ThreadCacheAllocator::ThreadCleaner ThreadCacheAllocator::_threadCleaner;
+}
\ No newline at end of file
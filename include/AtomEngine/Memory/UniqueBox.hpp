@@ -10,11 +10,14 @@ namespace Atom
         class UniqueBoxIdentifier { };
     }
 
-    template <typename TypeT, sizet StackSize>
-    class TUniqueBox: public TUniquePtr<TypeT>,
+    /// @tparam TypeT Base type of the stored object.
+    /// @tparam StackSize Count of memory units stored inline, larger objects spill to the allocator.
+    /// @tparam AllocatorPolicyT Policy used to reach the allocator, see AllocatorPolicy.hpp.
+    template <typename TypeT, sizet StackSize, typename AllocatorPolicyT = PolymorphicAllocatorPolicy>
+    class TUniqueBox: public TUniquePtr<TypeT, AllocatorPolicyT>,
         public Internal::UniqueBoxIdentifier
     {
-        using BaseT = TUniquePtr<TypeT>;
+        using BaseT = TUniquePtr<TypeT, AllocatorPolicyT>;
 
         template <typename OtherTypeT>
         constexpr static bool IsUniqueBox =
@@ -34,7 +37,7 @@ namespace Atom
         }
 
         template <sizet OtherStackSize>
-        TUniqueBox(const TUniqueBox<TypeT, OtherStackSize>& other) noexcept
+        TUniqueBox(const TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>& other) noexcept
         {
             _Copy(other);
         }
@@ -45,7 +48,7 @@ namespace Atom
         }
 
         template <sizet OtherStackSize>
-        TUniqueBox(TUniqueBox<TypeT, OtherStackSize>&& other) noexcept
+        TUniqueBox(TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>&& other) noexcept
         {
             _Swap(other);
         }
@@ -59,7 +62,7 @@ namespace Atom
         }
 
         template <sizet OtherStackSize>
-        TUniqueBox& operator = (const TUniqueBox<TypeT, OtherStackSize>& other) noexcept
+        TUniqueBox& operator = (const TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>& other) noexcept
         {
             _DestroyObject();
             _Copy(other);
@@ -76,7 +79,7 @@ namespace Atom
         }
 
         template <sizet OtherStackSize>
-        TUniqueBox& operator = (TUniqueBox<TypeT, OtherStackSize>&& other) noexcept
+        TUniqueBox& operator = (TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>&& other) noexcept
         {
             _DestroyObject();
             _Swap(other);
@@ -119,7 +122,7 @@ namespace Atom
         // does not destroys previous state,
         // assumes to be called from constructor
         template <sizet OtherStackSize>
-        void _Copy(const TUniqueBox<TypeT, OtherStackSize>& other) noexcept
+        void _Copy(const TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>& other) noexcept
         {
             _ptr = RCAST(TypeT*, _AllocMem(other._objectSize));
             _objectSize = other._objectSize;
@@ -128,7 +131,7 @@ namespace Atom
         }
 
         template <sizet OtherStackSize>
-        void _Swap(TUniqueBox<TypeT, OtherStackSize>& other) noexcept
+        void _Swap(TUniqueBox<TypeT, OtherStackSize, AllocatorPolicyT>& other) noexcept
         {
             byte tmpStackMem[StackSize];
 
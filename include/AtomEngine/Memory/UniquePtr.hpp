@@ -2,14 +2,16 @@
 #include "AtomEngine/Core.hpp"
 #include "AtomEngine/Memory/Ptr.hpp"
 #include "AtomEngine/Memory/IAllocator.hpp"
-#include "AtomEngine/Memory/DefaultAllocator.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
 
 namespace Atom
 {
-    template <typename TypeT>
+    /// @tparam TypeT Pointer type.
+    /// @tparam AllocatorPolicyT Policy used to reach the allocator, see AllocatorPolicy.hpp.
+    template <typename TypeT, typename AllocatorPolicyT = PolymorphicAllocatorPolicy>
     struct TUniquePtr: public TPtr<TypeT>
     {
-        using ThisT = TUniquePtr<TypeT>;
+        using ThisT = TUniquePtr<TypeT, AllocatorPolicyT>;
         using BaseT = TPtr<TypeT>;
 
     public:
@@ -26,16 +28,16 @@ namespace Atom
 
         TUniquePtr& operator = (TUniquePtr&& other) noexcept
         {
-            TUniquePtr tmp = other;
+            TUniquePtr tmp = move(other);
             Swap(tmp);
 
             return *this;
         }
 
         TUniquePtr(TypeT* ptr) noexcept:
-            BaseT(ptr), _allocator(DefaultAllocatorInstance) { }
+            BaseT(ptr) { }
 
-        TUniquePtr(TypeT* ptr, IAllocator& allocator) noexcept:
+        TUniquePtr(TypeT* ptr, AllocatorPolicyT allocator) noexcept:
             BaseT(ptr), _allocator(allocator) { }
 
         TUniquePtr& operator = (TypeT* ptr) noexcept
@@ -59,8 +61,9 @@ namespace Atom
         template <typename... ArgsT>
         static ThisT Create(ArgsT&&... args)
         {
-            TypeT* obj = DefaultAllocatorInstance.Construct<TypeT>(forward<ArgsT>(args)...);
-            return ThisT(obj, DefaultAllocatorInstance);
+            AllocatorPolicyT allocator;
+            TypeT* obj = allocator.template Construct<TypeT>(forward<ArgsT>(args)...);
+            return ThisT(obj, allocator);
         }
 
     public:
@@ -73,6 +76,6 @@ namespace Atom
     protected:
         using BaseT::_ptr;
 
-        IAllocator& _allocator = DefaultAllocatorInstance;
+        AllocatorPolicyT _allocator;
     };
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/DynamicLinkedMemPool.hpp"
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+
+namespace Atom
+{
+    /// VirtualMemPool takes its memory from a range of address space reserved up front.
+    /// 
+    /// The range == committed in pieces as the pool grows, and pages are backed by memory
+    /// only when first touched. Optionally the range == backed by huge pages,
+    /// which reduces TLB misses for large pools.
+    /// Shrink() frees memory of pages covered by free blocks, while keeping them usable.
+    /// Committed and discarded memory reads 0, so allocations from it skip clearing.
+    class VirtualMemPool: public virtual DynamicLinkedMemPool
+    {
+        using BaseT = DynamicLinkedMemPool;
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// @param reserveSize Count of memory units of address space to reserve,
+        ///     the pool never grows beyond this.
+        /// @param size Count of memory units to commit initially.
+        /// @param hugePages If true, asks the system to back the pool by huge pages.
+        VirtualMemPool(sizet reserveSize, sizet size = 0, bool hugePages = false) noexcept:
+            _hugePages(hugePages and GetHugePageSize() != 0)
+        {
+            _granularity = _hugePages ? GetHugePageSize() : GetPageSize();
+            _reserveSize = AlignUp(reserveSize, _granularity);
+            _mem = ReserveVirtualMemory(_reserveSize, _granularity);
+            if (_mem == nullptr)
+            {
+                _reserveSize = 0;
+            }
+
+            _AddMemory(size);
+        }
+
+        /// Uses a range reserved by the caller, which == not released by the pool.
+        /// 
+        /// @param mem Ptr to the range, reserved using ReserveVirtualMemory().
+        /// @param reserveSize Count of memory units of the range, multiple of GetPageSize().
+        /// @param size Count of memory units to commit initially.
+        VirtualMemPool(memptr mem, sizet reserveSize, sizet size = 0) noexcept:
+            _mem(mem), _reserveSize(reserveSize), _granularity(GetPageSize()),
+            _hugePages(false), _isOwner(false)
+        {
+            _AddMemory(size);
+        }
+
+        VirtualMemPool(const VirtualMemPool& other) = delete;
+        VirtualMemPool& operator = (const VirtualMemPool& other) = delete;
+
+        ~VirtualMemPool()
+        {
+            if (_mem != nullptr and _isOwner)
+            {
+                ReleaseVirtualMemory(_mem, _reserveSize);
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    public:
+        /// Count of memory units of reserved address space.
+        sizet ReservedCount() const noexcept
+        {
+            return _reserveSize;
+        }
+
+        /// Count of memory units of address space committed for the pool.
+        sizet CommittedCount() const noexcept
+        {
+            return _committed;
+        }
+
+        /// Frees memory of pages covered entirely by free blocks.
+        /// Pages stay committed, and are backed by memory again when touched.
+        /// 
+        /// The rest of these free blocks == cleared, so they are known to read 0.
+        /// Follows the hysteresis of DynamicLinkedMemPool::Shrink(), and skips blocks which
+        /// already read 0, so it == cheap when there == nothing to discard.
+        void Shrink() override
+        {
+            BaseT::Shrink();
+
+            if (FreeCount() <= _shrinkThreshold) return;
+
+            // free memory kept backed, so that allocations soon after do not refault
+            sizet retain = _shrinkRetain;
+            for (Chunk* chunk = _rootChunk; chunk != nullptr; chunk = chunk->next)
+            {
+                blockptr block = chunk->RootBlock();
+                for (; block->Size() != 0; block = block->Next())
+                {
+                    if (block->IsFree() != true or block->IsZero()) continue;
+
+                    if (retain > 0)
+                    {
+                        retain -= min(retain, block->Size());
+                        continue;
+                    }
+
+                    // links of free lists live at the start of free memory
+                    memptr begin = AlignUp(block->Mem() + MinBlockSize, _granularity);
+                    memptr end = RCAST(memptr, AlignDown(RCAST(sizet, block->Next()), _granularity));
+                    if (begin < end)
+                    {
+                        DiscardVirtualMemory(begin, end - begin);
+
+                        // clearing parts of huge pages would touch too much memory
+                        if (_hugePages != true)
+                        {
+                            memptr blockEnd = RCAST(memptr, block->Next());
+                            memset(block->Mem() + MinBlockSize, 0, begin - block->Mem() - MinBlockSize);
+                            memset(end, 0, blockEnd - end);
+                            block->SetZero(true);
+                        }
+                    }
+                }
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        /// Committed memory == either fresh or decommitted before, both read 0.
+        bool _IsAllocatedMemoryZero() const noexcept override
+        {
+            return true;
+        }
+
+        sizet _RoundChunkSize(sizet size) const noexcept override
+        {
+            return AlignUp(size, _granularity);
+        }
+
+        /// Commits next \p{size} memory units of the reserved range.
+        memptr _AllocateMemory(sizet size) override
+        {
+            size = AlignUp(size, _granularity);
+            if (size > _reserveSize - _committed) return nullptr;
+
+            memptr mem = _mem + _committed;
+            if (CommitVirtualMemory(mem, size, _hugePages) != true)
+            {
+                return nullptr;
+            }
+
+            _committed += size;
+            return mem;
+        }
+
+        /// Chunks are committed at the top of committed memory, so only the top chunk
+        /// can be returned without leaving a hole in the range, which would never be reused.
+        /// Chunks are listed newest first, so Shrink() releases free chunks from the top down.
+        /// Pages of free chunks below stay committed, Shrink() discards their memory instead.
+        bool _CanDeallocateMemory(memptr mem, sizet size) const noexcept override
+        {
+            return mem + AlignUp(size, _granularity) == _mem + _committed;
+        }
+
+        /// Decommits memory, the range == reused only if it == at the end of committed memory,
+        /// which == the case for every chunk released by Shrink().
+        void _DeallocateMemory(memptr mem, sizet size) override
+        {
+            size = AlignUp(size, _granularity);
+            DecommitVirtualMemory(mem, size);
+
+            if (mem + size == _mem + _committed)
+            {
+                _committed -= size;
+            }
+        }
+
+    /// ----------------------------------------------------------------------------
+    protected:
+        using BaseT::_AddMemory;
+
+        memptr _mem = nullptr;
+        sizet _reserveSize = 0;
+        sizet _committed = 0;
+        sizet _granularity = 0;
+        bool _hugePages;
+
+        /// Range == reserved by the pool itself, and released on destruction.
+        bool _isOwner = true;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include "AtomEngine/Core.hpp"
+#include "AtomEngine/Memory/Core.hpp"
+
+namespace Atom
+{
+    /// Size of a page of virtual memory, the granularity of all virtual memory functions.
+    ATOM_API sizet GetPageSize() noexcept;
+
+    /// Size of a huge page, 0 if huge pages are not supported.
+    ATOM_API sizet GetHugePageSize() noexcept;
+
+    /// Reserves a range of address space, without backing it by memory.
+    /// 
+    /// @param size Count of memory units to reserve, multiple of GetPageSize().
+    /// @param align Alignment of the range, multiple of GetPageSize().
+    /// @return Ptr to the range, nullptr if failed.
+    /// 
+    /// @note The range must be committed before being accessed.
+    ATOM_API memptr ReserveVirtualMemory(sizet size, sizet align) noexcept;
+
+    /// Releases the range reserved by ReserveVirtualMemory().
+    ATOM_API void ReleaseVirtualMemory(memptr mem, sizet size) noexcept;
+
+    /// Makes the part of reserved range accessible, pages are backed by memory on first access.
+    /// 
+    /// @param mem Ptr to the range to commit, aligned to GetPageSize().
+    /// @param size Count of memory units to commit, multiple of GetPageSize().
+    /// @param hugePages If true, asks the system to back the range by huge pages.
+    /// @return true if successful.
+    ATOM_API bool CommitVirtualMemory(memptr mem, sizet size, bool hugePages) noexcept;
+
+    /// Makes the part of committed range inaccessible again, and frees its memory.
+    ATOM_API void DecommitVirtualMemory(memptr mem, sizet size) noexcept;
+
+    /// Frees memory of the committed range, while keeping it accessible.
+    /// The range reads 0 afterwards.
+    ATOM_API void DiscardVirtualMemory(memptr mem, sizet size) noexcept;
+
+    /// Maps the whole file into memory, pages are read from the file on first access.
+    /// Writes to the memory are private to the process, and never reach the file.
+    /// 
+    /// @param path Path of the file.
+    /// @param outSize Set to count of memory units of the file.
+    /// @return Ptr to memory, aligned to GetPageSize(), nullptr if failed or the file == empty.
+    ATOM_API memptr MapFile(const char* path, sizet& outSize) noexcept;
+
+    /// Unmaps memory mapped by MapFile().
+    ATOM_API void UnmapFile(memptr mem, sizet size) noexcept;
+}
\ No newline at end of file
@@ -1,10 +1,12 @@
+#include <string>
+
 #include "AtomEngine/Memory.hpp"
 
 namespace Atom
 {
-    class GlobalRootMemPool: public HeapMemPool<>
+    class GlobalRootMemPool: public HeapMemPool
     {
-        using BaseT = HeapMemPool<>;
+        using BaseT = HeapMemPool;
 
     /// ----------------------------------------------------------------------------
     public:
@@ -13,10 +15,17 @@ namespace Atom
 
     /// ----------------------------------------------------------------------------
     protected:
+        /// Chunks come from calloc, large ones are fresh pages which need no clearing,
+        /// so the pool need not clear allocations from them.
+        bool _IsAllocatedMemoryZero() const noexcept override final
+        {
+            return true;
+        }
+
         memptr _AllocateMemory(sizet size) override final
         {
             // default implementation uses global mem pool
-            return SCAST(memptr, malloc(size));
+            return SCAST(memptr, calloc(1, size));
         }
 
         void _DeallocateMemory(memptr mem, sizet size) override final
@@ -27,5 +36,38 @@ namespace Atom
     };
 
     ATOM_API DefaultAllocator DefaultAllocatorInstance = DefaultAllocator();
-    ATOM_API IAllocator* globalAllocator = new GlobalRootMemPool(0);
+
+    // GlobalRootMemPool == not thread safe, ThreadCacheAllocator serializes access to it
+    // and serves small allocations from per thread caches.
+#if ATOM_PROFILE_ALLOCATIONS
+    static ProfilingAllocator* globalProfiler = new ProfilingAllocator(
+        *new ThreadCacheAllocator(*new GlobalRootMemPool(0)));
+
+    ATOM_API IAllocator* globalAllocator = globalProfiler;
+
+    /// Writes the report of globalProfiler at shutdown, to files named by
+    /// ATOM_ALLOCATION_PROFILE environment variable, "AllocationProfile" by default.
+    static struct GlobalProfilerReport
+    {
+        ~GlobalProfilerReport()
+        {
+            const char* name = getenv("ATOM_ALLOCATION_PROFILE");
+            std::string path = name != nullptr ? name : "AllocationProfile";
+
+            if (FILE* file = fopen((path + ".txt").c_str(), "w"))
+            {
+                globalProfiler->WriteReport(file);
+                fclose(file);
+            }
+
+            if (FILE* file = fopen((path + ".folded").c_str(), "w"))
+            {
+                globalProfiler->WriteFoldedStacks(file);
+                fclose(file);
+            }
+        }
+    } globalProfilerReport;
+#else
+    ATOM_API IAllocator* globalAllocator = new ThreadCacheAllocator(*new GlobalRootMemPool(0));
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <cstdlib>
+#include <vector>
+
+#include "AtomEngine/Memory/ProfilingAllocator.hpp"
+
+#if defined(ATOM_PLATFORM_WIN)
+#include <windows.h>
+#else
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+namespace Atom
+{
+#if defined(ATOM_PLATFORM_WIN)
+
+    ATOM_API sizet CaptureCallStack(void** frames, sizet count, sizet skip) noexcept
+    {
+        return RtlCaptureStackBackTrace(SCAST(DWORD, skip + 1), SCAST(DWORD, count), frames, nullptr);
+    }
+
+    /// Writes the address, symbols need debug info loaded through DbgHelp,
+    /// which == left to external tools.
+    static void WriteFrame(FILE* file, void* frame)
+    {
+        fprintf(file, "%p", frame);
+    }
+
+#else
+
+    ATOM_API sizet CaptureCallStack(void** frames, sizet count, sizet skip) noexcept
+    {
+        void* buffer[ProfilingAllocator::MaxStackDepth + 16];
+        sizet captureCount = min(count + skip + 1, sizeof(buffer) / sizeof(void*));
+
+        int captured = backtrace(buffer, SCAST(int, captureCount));
+        if (captured <= SCAST(int, skip + 1)) return 0;
+
+        sizet frameCount = min(SCAST(sizet, captured) - skip - 1, count);
+        memcpy(RCAST(memptr, frames), RCAST(memptr, buffer + skip + 1), frameCount * sizeof(void*));
+        return frameCount;
+    }
+
+    /// Writes the demangled name of function containing \p{frame}, the address if not found.
+    /// Characters of the folded stack format are replaced, so names can be used as frames.
+    static void WriteFrame(FILE* file, void* frame)
+    {
+        Dl_info info;
+        if (dladdr(frame, &info) == 0 or info.dli_sname == nullptr)
+        {
+            fprintf(file, "%p", frame);
+            return;
+        }
+
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        const char* name = status == 0 ? demangled : info.dli_sname;
+
+        for (const char* c = name; *c != '\0'; c++)
+        {
+            fputc(*c == ';' ? ':' : *c, file);
+        }
+
+        free(demangled);
+    }
+
+#endif
+
+    /// Returns ready sites, sorted by allocated memory units.
+    static std::vector<const ProfilingAllocator::Site*> GetSortedSites(const ProfilingAllocator& allocator)
+    {
+        std::vector<const ProfilingAllocator::Site*> sites;
+        for (sizet i = 0; i < allocator.SiteCapacity(); i++)
+        {
+            const ProfilingAllocator::Site& site = allocator.GetSite(i);
+            if (site.isReady.load(std::memory_order_acquire) and site.allocCount.load() > 0)
+            {
+                sites.push_back(&site);
+            }
+        }
+
+        // qsort, as std::sort finds Atom::swap through ADL
+        qsort(sites.data(), sites.size(), sizeof(sites[0]), [](const void* lhs, const void* rhs)
+        {
+            sizet lhsBytes = (*SCAST(const ProfilingAllocator::Site* const*, lhs))->allocBytes.load();
+            sizet rhsBytes = (*SCAST(const ProfilingAllocator::Site* const*, rhs))->allocBytes.load();
+            return lhsBytes > rhsBytes ? -1 : lhsBytes < rhsBytes ? 1 : 0;
+        });
+
+        return sites;
+    }
+
+    ATOM_API void ProfilingAllocator::WriteReport(FILE* file) const
+    {
+        fprintf(file, "# allocations sampled 1 in %zu, lifetimes in microseconds\n", _sampleInterval);
+        fprintf(file, "# %14s %10s %14s %10s %12s %12s  site\n",
+            "bytes", "count", "live bytes", "live", "avg life", "max life");
+
+        for (const Site* site : GetSortedSites(*this))
+        {
+            sizet allocCount = site->allocCount.load();
+            sizet deallocCount = site->deallocCount.load();
+            sizet allocBytes = site->allocBytes.load();
+            sizet deallocBytes = site->deallocBytes.load();
+            sizet avgLife = deallocCount > 0 ? site->lifetimeSum.load() / deallocCount : 0;
+
+            fprintf(file, "  %14zu %10zu %14zu %10zu %12zu %12zu  ", allocBytes, allocCount,
+                allocBytes - deallocBytes, allocCount - deallocCount,
+                avgLife / 1000, site->lifetimeMax.load() / 1000);
+
+            if (site->tag != nullptr)
+            {
+                fprintf(file, "[%s] ", site->tag);
+            }
+
+            for (sizet i = 0; i < site->frameCount; i++)
+            {
+                if (i > 0) fputs(" <- ", file);
+                WriteFrame(file, site->frames[i]);
+            }
+
+            fputc('\n', file);
+        }
+    }
+
+    ATOM_API void ProfilingAllocator::WriteFoldedStacks(FILE* file) const
+    {
+        for (const Site* site : GetSortedSites(*this))
+        {
+            fputs(site->tag != nullptr ? site->tag : "[untagged]", file);
+
+            // folded stacks list the outermost frame first
+            for (sizet i = site->frameCount; i > 0; i--)
+            {
+                fputc(';', file);
+                WriteFrame(file, site->frames[i - 1]);
+            }
+
+            fprintf(file, " %zu\n", site->allocBytes.load());
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "AtomEngine/Memory/VirtualMemory.hpp"
+
+#if defined(ATOM_PLATFORM_WIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Atom
+{
+#if defined(ATOM_PLATFORM_WIN)
+
+    ATOM_API sizet GetPageSize() noexcept
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+
+        // address space == reserved with this granularity
+        return info.dwAllocationGranularity;
+    }
+
+    ATOM_API sizet GetHugePageSize() noexcept
+    {
+        return GetLargePageMinimum();
+    }
+
+    ATOM_API memptr ReserveVirtualMemory(sizet size, sizet align) noexcept
+    {
+        if (size > NPOS - align) return nullptr;
+
+        // reserve more to align the range, then reserve again only the aligned part
+        for (sizet i = 0; i < 3; i++)
+        {
+            memptr mem = SCAST(memptr, VirtualAlloc(nullptr, size + align, MEM_RESERVE, PAGE_NOACCESS));
+            if (mem == nullptr) return nullptr;
+
+            VirtualFree(mem, 0, MEM_RELEASE);
+            mem = SCAST(memptr, VirtualAlloc(AlignUp(mem, align), size, MEM_RESERVE, PAGE_NOACCESS));
+            if (mem != nullptr) return mem;
+        }
+
+        return nullptr;
+    }
+
+    ATOM_API void ReleaseVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        VirtualFree(mem, 0, MEM_RELEASE);
+    }
+
+    ATOM_API bool CommitVirtualMemory(memptr mem, sizet size, bool hugePages) noexcept
+    {
+        // large pages on windows need privileges and cannot be committed lazily
+        return VirtualAlloc(mem, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    ATOM_API void DecommitVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        VirtualFree(mem, size, MEM_DECOMMIT);
+    }
+
+    ATOM_API void DiscardVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        // MEM_RESET keeps old contents, recommitted pages read 0 instead
+        VirtualFree(mem, size, MEM_DECOMMIT);
+        VirtualAlloc(mem, size, MEM_COMMIT, PAGE_READWRITE);
+    }
+
+    ATOM_API memptr MapFile(const char* path, sizet& outSize) noexcept
+    {
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+        LARGE_INTEGER size;
+        memptr mem = nullptr;
+        if (GetFileSizeEx(file, &size) and size.QuadPart > 0)
+        {
+            // copy on write, so the view == writable without changing the file
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                mem = SCAST(memptr, MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+        outSize = mem != nullptr ? SCAST(sizet, size.QuadPart) : 0;
+        return mem;
+    }
+
+    ATOM_API void UnmapFile(memptr mem, sizet size) noexcept
+    {
+        UnmapViewOfFile(mem);
+    }
+
+#else
+
+    ATOM_API sizet GetPageSize() noexcept
+    {
+        return SCAST(sizet, sysconf(_SC_PAGESIZE));
+    }
+
+    ATOM_API sizet GetHugePageSize() noexcept
+    {
+#if defined(ATOM_PLATFORM_LINUX)
+        return 2 * 1024 * 1024;
+#else
+        return 0;
+#endif
+    }
+
+    ATOM_API memptr ReserveVirtualMemory(sizet size, sizet align) noexcept
+    {
+        if (size > NPOS - align) return nullptr;
+
+        // reserve more to align the range, then unmap the unaligned head and tail
+        sizet reserveSize = size + align;
+        void* reserved = mmap(nullptr, reserveSize, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if (reserved == MAP_FAILED) return nullptr;
+
+        memptr begin = SCAST(memptr, reserved);
+        memptr mem = AlignUp(begin, align);
+        memptr end = begin + reserveSize;
+
+        if (mem != begin) munmap(begin, mem - begin);
+        if (mem + size != end) munmap(mem + size, end - mem - size);
+
+        return mem;
+    }
+
+    ATOM_API void ReleaseVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        munmap(mem, size);
+    }
+
+    ATOM_API bool CommitVirtualMemory(memptr mem, sizet size, bool hugePages) noexcept
+    {
+        if (mprotect(mem, size, PROT_READ | PROT_WRITE) != 0)
+        {
+            return false;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (hugePages)
+        {
+            // only a hint, fails if transparent huge pages are disabled
+            madvise(mem, size, MADV_HUGEPAGE);
+        }
+#endif
+
+        return true;
+    }
+
+    ATOM_API void DecommitVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        madvise(mem, size, MADV_DONTNEED);
+        mprotect(mem, size, PROT_NONE);
+    }
+
+    ATOM_API void DiscardVirtualMemory(memptr mem, sizet size) noexcept
+    {
+        // private anonymous pages read as 0 after this
+        madvise(mem, size, MADV_DONTNEED);
+    }
+
+    ATOM_API memptr MapFile(const char* path, sizet& outSize) noexcept
+    {
+        outSize = 0;
+        int file = open(path, O_RDONLY);
+        if (file < 0) return nullptr;
+
+        struct stat info;
+        void* mem = MAP_FAILED;
+        if (fstat(file, &info) == 0 and info.st_size > 0)
+        {
+            mem = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        }
+
+        // the mapping keeps the file alive
+        close(file);
+        if (mem == MAP_FAILED) return nullptr;
+
+        outSize = SCAST(sizet, info.st_size);
+        return SCAST(memptr, mem);
+    }
+
+    ATOM_API void UnmapFile(memptr mem, sizet size) noexcept
+    {
+        munmap(mem, size);
+    }
+
+#endif
+}
\ No newline at end of file
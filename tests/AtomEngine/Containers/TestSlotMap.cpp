@@ -0,0 +1,96 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Containers/SlotMap.hpp"
+
+using namespace Atom;
+
+TEST_CASE("SlotMap")
+{
+    SlotMap<int> map;
+    REQUIRE(map.Count() == 0);
+
+    SECTION("Insert and Get")
+    {
+        SlotMap<int>::KeyT k0 = map.Insert(10);
+        SlotMap<int>::KeyT k1 = map.Insert(20);
+
+        CHECK(map.Count() == 2);
+        CHECK(k0 != k1);
+        REQUIRE(map.Get(k0) != nullptr);
+        CHECK(*map.Get(k0) == 10);
+        CHECK(*map.Get(k1) == 20);
+        CHECK(map.Get(SlotMap<int>::KeyT{ }) == nullptr);
+    }
+
+    SECTION("Erase moves the last element into the hole")
+    {
+        SlotMap<int>::KeyT keys[5];
+        for (int i = 0; i < 5; i++)
+        {
+            keys[i] = map.Insert(i);
+        }
+
+        CHECK(map.Erase(keys[1]));
+        CHECK(map.Count() == 4);
+        CHECK(map.Values()[1] == 4);
+        CHECK(map.KeyAt(1) == keys[4]);
+
+        for (int i : { 0, 2, 3, 4 })
+        {
+            REQUIRE(map.Get(keys[i]) != nullptr);
+            CHECK(*map.Get(keys[i]) == i);
+        }
+
+        CHECK(map.Erase(keys[4]));
+        CHECK(map.Erase(keys[4]) == false);
+        CHECK(map.Count() == 3);
+    }
+
+    SECTION("Stale keys")
+    {
+        SlotMap<int>::KeyT k0 = map.Insert(1);
+        map.Erase(k0);
+
+        // the slot == reused with a new generation
+        SlotMap<int>::KeyT k1 = map.Insert(2);
+        CHECK(k1.index == k0.index);
+        CHECK(map.Contains(k0) == false);
+        CHECK(map.Get(k0) == nullptr);
+        CHECK(*map.Get(k1) == 2);
+    }
+
+    SECTION("Dense iteration")
+    {
+        SlotMap<int>::KeyT keys[100];
+        for (int i = 0; i < 100; i++)
+        {
+            keys[i] = map.Insert(i);
+        }
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            map.Erase(keys[i]);
+        }
+
+        // odd values stay, 1 + 3 + ... + 99
+        int sum = 0;
+        ArrayView<int> values = map.Values();
+        for (sizet i = 0; i < values.Count(); i++)
+        {
+            sum += values[i];
+        }
+
+        CHECK(values.Count() == 50);
+        CHECK(sum == 2500);
+
+        for (sizet i = 0; i < map.Count(); i++)
+        {
+            map.Data()[i] *= 2;
+        }
+
+        CHECK(*map.Get(keys[7]) == 14);
+
+        map.Clear();
+        CHECK(map.Count() == 0);
+        CHECK(map.Contains(keys[7]) == false);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Containers/VirtualArray.hpp"
+
+using namespace Atom;
+
+TEST_CASE("VirtualArray")
+{
+    constexpr sizet maxCount = 1024 * 1024;
+    VirtualArray<int> array(maxCount);
+
+    REQUIRE(array.MaxCount() == maxCount);
+    REQUIRE(array.Count() == 0);
+    REQUIRE(array.CommittedCount() == 0);
+
+    SECTION("Growth keeps elements in place")
+    {
+        array.InsertBack(0);
+        int* first = array.Data();
+
+        for (int i = 1; i < 100000; i++)
+        {
+            array.InsertBack(i);
+        }
+
+        CHECK(array.Data() == first);
+        CHECK(array.Count() == 100000);
+        CHECK(array[0] == 0);
+        CHECK(array[99999] == 99999);
+
+        // committed pages cover the elements, not the whole reserved range
+        CHECK(array.CommittedCount() >= 100000 * sizeof(int));
+        CHECK(array.CommittedCount() < maxCount * sizeof(int));
+    }
+
+    SECTION("Used through IDynamicArray")
+    {
+        IDynamicArray<int>& list = array;
+        for (int i = 0; i < 10; i++)
+        {
+            list.InsertBack(i);
+        }
+
+        list.RemoveBack();
+        CHECK(list.Count() == 9);
+        CHECK(list[8] == 8);
+        CHECK(list.Data() == array.Data());
+    }
+
+    SECTION("ShrinkToFit decommits pages")
+    {
+        array.Reserve(maxCount);
+        CHECK(array.CommittedCount() == maxCount * sizeof(int));
+
+        array.InsertBack(7);
+        array.ShrinkToFit();
+        CHECK(array.CommittedCount() == GetPageSize());
+        CHECK(array[0] == 7);
+
+        // recommitted pages read 0
+        array.Resize(maxCount);
+        CHECK(array.Data()[maxCount - 1] == 0);
+    }
+
+    SECTION("Growing beyond MaxCount throws")
+    {
+        array.Resize(maxCount);
+        CHECK_THROWS_AS(array.Resize(maxCount + 1), std::length_error);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/AllocatorPolicy.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/ObjectPool.hpp"
+#include "AtomEngine/Memory/UniquePtr.hpp"
+#include "AtomEngine/Memory/SharedPtr.hpp"
+#include "AtomEngine/Memory/UniqueBox.hpp"
+#include "AtomEngine/Containers/DynamicArray.hpp"
+
+using namespace Atom;
+
+struct PolicyItem
+{
+    int value;
+};
+
+TEST_CASE("AllocatorPolicy")
+{
+    HeapMemPool pool(4096);
+
+    SECTION("DynamicArray")
+    {
+        {
+            DynamicArray<int, TAllocatorPolicy<HeapMemPool>> values(pool);
+            for (int i = 0; i < 100; i++)
+            {
+                values.InsertBack(i);
+            }
+
+            CHECK(values.Count() == 100);
+            CHECK(values[99] == 99);
+            CHECK(pool.UsedCount() >= 100 * sizeof(int));
+        }
+
+        CHECK(pool.UsedCount() == 0);
+
+        // an IAllocator converts to the default policy
+        {
+            DynamicArray<int> values(pool);
+            values.InsertBack(1);
+            CHECK(pool.UsedCount() > 0);
+        }
+
+        DynamicArray<int, GlobalAllocatorPolicy> values;
+        values.InsertBack(1);
+        CHECK(values[0] == 1);
+    }
+
+    SECTION("TUniquePtr and TSharedPtr")
+    {
+        using PoolT = TObjectPool<PolicyItem>;
+        using PolicyT = TAllocatorPolicy<PoolT>;
+
+        PoolT items;
+        {
+            PolicyT policy(items);
+            TUniquePtr<PolicyItem, PolicyT> unique(policy.Construct<PolicyItem>(PolicyItem{ 1 }), items);
+            TSharedPtr<PolicyItem, PolicyT> shared(policy.Construct<PolicyItem>(PolicyItem{ 2 }), items);
+            TSharedPtr<PolicyItem, PolicyT> sharedCopy = shared;
+
+            CHECK(unique->value == 1);
+            CHECK(sharedCopy->value == 2);
+            CHECK(shared.RefCount() == 2);
+            CHECK(items.UsedCount() == 2 * PoolT::SlotSize);
+        }
+
+        CHECK(items.UsedCount() == 0);
+
+        TUniquePtr<int, GlobalAllocatorPolicy> global = TUniquePtr<int, GlobalAllocatorPolicy>::Create(3);
+        CHECK(*global == 3);
+    }
+
+    SECTION("TUniqueBox")
+    {
+        struct Large
+        {
+            int values[64];
+        };
+
+        TUniqueBox<Large, 16, GlobalAllocatorPolicy> box = Large{ { 5 } };
+        CHECK(box->values[0] == 5);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <filesystem>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ArenaImage.hpp"
+
+using namespace Atom;
+
+struct ImageNode
+{
+    int value;
+    OffsetPtr<ImageNode> next;
+};
+
+TEST_CASE("ArenaImage")
+{
+    std::string path = (std::filesystem::temp_directory_path() / "TestArenaImage.bin").string();
+
+    ArenaImage image(1024 * 1024);
+    REQUIRE(image.Size() >= 1024 * 1024);
+
+    SECTION("OffsetPtr")
+    {
+        ImageNode* nodes = image.ConstructMultiple<ImageNode>(2);
+        nodes[0].next = &nodes[1];
+        CHECK(nodes[0].next.Get() == &nodes[1]);
+        CHECK(nodes[1].next.IsNull());
+
+        // copies point to the same object
+        OffsetPtr<ImageNode> copy = nodes[0].next;
+        CHECK(copy.Get() == &nodes[1]);
+        CHECK(copy == nodes[0].next);
+
+        // pointers to objects before them
+        nodes[1].next = &nodes[0];
+        CHECK(nodes[1].next->next.Get() == &nodes[1]);
+    }
+
+    SECTION("Save and Load")
+    {
+        ImageNode* head = nullptr;
+        for (int i = 0; i < 1000; i++)
+        {
+            ImageNode* node = image.Construct<ImageNode>();
+            node->value = i;
+            node->next = head;
+            head = node;
+        }
+
+        image.SetRoot(head);
+        REQUIRE(image.Save(path.c_str()));
+
+        ArenaImage loaded;
+        REQUIRE(loaded.Load(path.c_str()));
+        CHECK(loaded.IsMapped());
+        CHECK(loaded.UsedCount() == image.UsedCount());
+
+        ImageNode* node = loaded.GetRoot<ImageNode>();
+        REQUIRE(node != nullptr);
+        CHECK(node != head);
+
+        int count = 0;
+        for (; node != nullptr; node = node->next.Get())
+        {
+            CHECK(node->value == 999 - count);
+            count++;
+        }
+
+        CHECK(count == 1000);
+
+        // objects are writable, a loaded image == full
+        loaded.GetRoot<ImageNode>()->value = -1;
+        CHECK(loaded.GetRoot<ImageNode>()->value == -1);
+        CHECK(loaded.AllocateRaw(16) == nullptr);
+    }
+
+    SECTION("Invalid files")
+    {
+        ArenaImage loaded;
+        CHECK(loaded.Load((path + ".missing").c_str()) == false);
+
+        FILE* file = fopen(path.c_str(), "wb");
+        fputs("not an image", file);
+        fclose(file);
+
+        CHECK(loaded.Load(path.c_str()) == false);
+        CHECK(loaded.GetRoot<ImageNode>() == nullptr);
+    }
+
+    std::filesystem::remove(path);
+}
\ No newline at end of file
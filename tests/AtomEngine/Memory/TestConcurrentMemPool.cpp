@@ -0,0 +1,214 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ConcurrentMemPool.hpp"
+
+using namespace Atom;
+
+TEST_CASE("ConcurrentMemPool")
+{
+    constexpr sizet arenaReserveSize = 16 * 1024 * 1024;
+
+    SECTION("Allocation")
+    {
+        ConcurrentMemPool pool(arenaReserveSize, 4);
+        REQUIRE(pool.ArenaCount() == 4);
+
+        memptr mem0 = pool.AllocateRaw(100);
+        memptr mem1 = pool.AllocateRaw(100, true, 256);
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        CHECK(mem0 != mem1);
+        CHECK(IsAligned(mem1, 256));
+        CHECK(SCAST(sizet, mem0[99]) == 0);
+        CHECK(pool.UsedCount() > 0);
+
+        pool.DeallocateRaw(mem0, 100);
+        pool.DeallocateRaw(mem1, 100);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Reallocation moves memory to another arena when its arena == full")
+    {
+        ConcurrentMemPool pool(64 * 1024, 4);
+
+        memptr mem = pool.AllocateRaw(16);
+        REQUIRE(mem != nullptr);
+        for (sizet i = 0; i < 16; i++)
+        {
+            mem[i] = SCAST(byte, i);
+        }
+
+        // fill most of the arena, so the block can't grow in it
+        std::vector<memptr> fill;
+        for (sizet i = 0; i < 40; i++)
+        {
+            fill.push_back(pool.AllocateRaw(1024, false));
+            REQUIRE(fill.back() != nullptr);
+        }
+
+        memptr newMem = pool.ReallocateRaw(mem, 40 * 1024);
+        REQUIRE(newMem != nullptr);
+        for (sizet i = 0; i < 16; i++)
+        {
+            CHECK(SCAST(sizet, newMem[i]) == i);
+        }
+
+        CHECK(SCAST(sizet, newMem[40 * 1024 - 1]) == 0);
+
+        pool.DeallocateRaw(newMem, 40 * 1024);
+        for (memptr block : fill)
+        {
+            pool.DeallocateRaw(block, 1024);
+        }
+
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Batch allocation")
+    {
+        ConcurrentMemPool pool(arenaReserveSize, 4);
+
+        memptr mems[1000];
+        REQUIRE(pool.AllocateBatch(32, 1000, mems));
+        for (memptr mem : mems)
+        {
+            REQUIRE(mem != nullptr);
+            CHECK(SCAST(sizet, mem[31]) == 0);
+        }
+
+        pool.DeallocateBatch(mems, 1000, 32);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Statistics of all arenas")
+    {
+        ConcurrentMemPool pool(arenaReserveSize, 4);
+
+        std::vector<memptr> blocks;
+        std::vector<std::thread> threads;
+        std::mutex blocksLock;
+        for (sizet i = 0; i < 4; i++)
+        {
+            threads.emplace_back([&]
+            {
+                for (sizet j = 0; j < 10; j++)
+                {
+                    memptr mem = pool.AllocateRaw(64);
+                    std::lock_guard<std::mutex> guard(blocksLock);
+                    blocks.push_back(mem);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) thread.join();
+
+        MemPoolStats stats = pool.Stats();
+        CHECK(stats.size == pool.Size());
+        CHECK(stats.usedCount == pool.UsedCount());
+#if ATOM_MEMORY_STATS
+        CHECK(stats.allocCount == 40);
+#endif
+
+        for (memptr mem : blocks)
+        {
+            pool.DeallocateRaw(mem, 64);
+        }
+
+        CHECK(pool.UsedCount() == 0);
+        pool.Shrink();
+    }
+
+    SECTION("Stress, blocks freed and reallocated on other threads")
+    {
+        constexpr sizet threadCount = 8;
+        constexpr sizet opCount = 20000;
+        constexpr sizet liveCount = 128;
+
+        ConcurrentMemPool pool(arenaReserveSize, 4);
+
+        // each thread owns a slot range, and after every round passes its blocks to the next thread
+        std::vector<memptr> slots[threadCount];
+        std::vector<sizet> sizes[threadCount];
+        for (sizet i = 0; i < threadCount; i++)
+        {
+            slots[i].resize(liveCount, nullptr);
+            sizes[i].resize(liveCount, 0);
+        }
+
+        std::atomic<sizet> errorCount = 0;
+        for (sizet round = 0; round < 2; round++)
+        {
+            std::vector<std::thread> threads;
+            for (sizet i = 0; i < threadCount; i++)
+            {
+                threads.emplace_back([&, i, round]
+                {
+                    sizet owner = (i + round) % threadCount;
+                    std::vector<memptr>& blocks = slots[owner];
+                    std::vector<sizet>& blockSizes = sizes[owner];
+                    sizet pattern = owner + 1;
+
+                    sizet random = i * 7919 + 1;
+                    for (sizet j = 0; j < opCount; j++)
+                    {
+                        random = random * 6364136223846793005ull + 1442695040888963407ull;
+                        sizet slot = (random >> 33) % liveCount;
+                        sizet size = 8 + (random >> 40) % 2048;
+
+                        memptr& mem = blocks[slot];
+                        if (mem != nullptr)
+                        {
+                            if (SCAST(sizet, mem[0]) != pattern
+                                or SCAST(sizet, mem[blockSizes[slot] - 1]) != pattern)
+                            {
+                                errorCount++;
+                            }
+                        }
+
+                        if (mem == nullptr)
+                        {
+                            mem = pool.AllocateRaw(size, false);
+                        }
+                        else if (j % 3 == 0)
+                        {
+                            mem = pool.ReallocateRaw(mem, size, false);
+                        }
+                        else
+                        {
+                            pool.DeallocateRaw(mem, blockSizes[slot]);
+                            mem = nullptr;
+                            continue;
+                        }
+
+                        if (mem == nullptr)
+                        {
+                            errorCount++;
+                            continue;
+                        }
+
+                        memset(mem, SCAST(int, pattern), size);
+                        blockSizes[slot] = size;
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) thread.join();
+        }
+
+        CHECK(errorCount == 0);
+
+        for (sizet i = 0; i < threadCount; i++)
+        {
+            for (sizet j = 0; j < liveCount; j++)
+            {
+                pool.DeallocateRaw(slots[i][j], sizes[i][j]);
+            }
+        }
+
+        CHECK(pool.UsedCount() == 0);
+    }
+}
\ No newline at end of file
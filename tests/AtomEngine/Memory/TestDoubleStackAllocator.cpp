@@ -0,0 +1,112 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/DoubleStackAllocator.hpp"
+
+using namespace Atom;
+
+TEST_CASE("DoubleStackAllocator")
+{
+    DoubleStackAllocator allocator(1024);
+    REQUIRE(allocator.Size() == 1024);
+
+    SECTION("Stacks grow towards each other")
+    {
+        memptr lower = allocator.AllocateRaw(100);
+        memptr upper = allocator.Upper().AllocateRaw(100);
+
+        REQUIRE(lower != nullptr);
+        REQUIRE(upper != nullptr);
+        CHECK(lower < upper);
+        CHECK(RCAST(sizet, upper) % allocator.Align == 0);
+
+        sizet freeCount = allocator.FreeCount();
+        CHECK(allocator.AllocateRaw(freeCount + 1) == nullptr);
+        CHECK(allocator.Upper().AllocateRaw(freeCount) != nullptr);
+        CHECK(allocator.FreeCount() == 0);
+        CHECK(allocator.AllocateRaw(1) == nullptr);
+    }
+
+    SECTION("Markers")
+    {
+        DoubleStackAllocator::Marker lowerMarker = allocator.GetLowerMarker();
+        DoubleStackAllocator::Marker upperMarker = allocator.GetUpperMarker();
+
+        allocator.AllocateRaw(100);
+        memptr upper = allocator.Upper().AllocateRaw(100);
+        allocator.Upper().AllocateRaw(100);
+
+        allocator.FreeToLowerMarker(lowerMarker);
+        sizet blockSize = 112 + allocator.BlockHeaderSize;
+        CHECK(allocator.FreeCount() == 1024 - 2 * blockSize - allocator.BlockHeaderSize);
+
+        allocator.FreeToUpperMarker(upperMarker);
+        CHECK(allocator.FreeCount() == 1024 - allocator.BlockHeaderSize);
+        CHECK(allocator.Upper().AllocateRaw(100) == upper);
+    }
+
+    SECTION("Reallocation keeps contents")
+    {
+        memptr upper = allocator.Upper().AllocateRaw(16);
+        for (sizet i = 0; i < 16; i++)
+        {
+            upper[i] = i;
+        }
+
+        upper = allocator.Upper().ReallocateRaw(upper, 64);
+        REQUIRE(upper != nullptr);
+        for (sizet i = 0; i < 16; i++)
+        {
+            CHECK(SCAST(sizet, upper[i]) == i);
+        }
+
+        CHECK(SCAST(sizet, upper[63]) == 0);
+    }
+
+    SECTION("Reallocation below the top of lower stack keeps its neighbours")
+    {
+        memptr mem0 = allocator.AllocateRaw(16);
+        memptr mem1 = allocator.AllocateRaw(16);
+        memptr mem2 = allocator.AllocateRaw(16);
+        memset(mem1, 1, 16);
+        mem2[0] = 2;
+
+        memptr mem = allocator.ReallocateRaw(mem0, 32);
+        REQUIRE(mem != nullptr);
+        CHECK(mem != mem0);
+        for (sizet i = 16; i < 32; i++)
+        {
+            CHECK(SCAST(sizet, mem[i]) == 0);
+        }
+
+        memset(mem, 0xff, 32);
+        CHECK(SCAST(sizet, mem1[0]) == 1);
+        CHECK(SCAST(sizet, mem2[0]) == 2);
+    }
+
+    SECTION("Reallocation below the top of upper stack keeps its neighbours")
+    {
+        memptr mem0 = allocator.Upper().AllocateRaw(16);
+        memptr mem1 = allocator.Upper().AllocateRaw(16);
+        memptr mem2 = allocator.Upper().AllocateRaw(16);
+        memset(mem0, 1, 16);
+        memset(mem1, 2, 16);
+        mem2[0] = 3;
+
+        // shrinks in place
+        CHECK(allocator.Upper().ReallocateRaw(mem1, 8) == mem1);
+        CHECK(SCAST(sizet, mem1[0]) == 2);
+        CHECK(SCAST(sizet, mem0[0]) == 1);
+
+        memptr mem = allocator.Upper().ReallocateRaw(mem1, 32);
+        REQUIRE(mem != nullptr);
+        CHECK(mem != mem1);
+        CHECK(SCAST(sizet, mem[7]) == 2);
+        for (sizet i = 8; i < 32; i++)
+        {
+            CHECK(SCAST(sizet, mem[i]) == 0);
+        }
+
+        memset(mem, 0xff, 32);
+        CHECK(SCAST(sizet, mem0[0]) == 1);
+        CHECK(SCAST(sizet, mem2[0]) == 3);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/FrameAllocator.hpp"
+
+using namespace Atom;
+
+TEST_CASE("FrameAllocator")
+{
+    FrameAllocator<2> allocator(1024);
+    REQUIRE(allocator.Size() == 1024);
+
+    int* frame0 = allocator.Construct<int>(10);
+    REQUIRE(frame0 != nullptr);
+
+    allocator.NextFrame();
+    int* frame1 = allocator.Construct<int>(11);
+    REQUIRE(frame1 != nullptr);
+
+    // memory of the previous frame stays valid
+    CHECK(*frame0 == 10);
+    CHECK(allocator.Previous().UsedCount() != 0);
+
+    allocator.NextFrame();
+    CHECK(allocator.Current().UsedCount() == 0);
+    CHECK(allocator.Allocate<int>() == frame0);
+    CHECK(*frame1 == 11);
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HandleMemPool.hpp"
+
+using namespace Atom;
+
+struct Entity
+{
+    sizet id;
+    float position[3];
+};
+
+TEST_CASE("HandleMemPool")
+{
+    HandleMemPool pool(4096);
+    REQUIRE(pool.Size() >= 4096);
+
+    SECTION("Allocation")
+    {
+        THandle<Entity> h0 = pool.Construct<Entity>(Entity{ 1, { } });
+        THandle<Entity> h1 = pool.Construct<Entity>(Entity{ 2, { } });
+
+        REQUIRE(h0.IsNull() != true);
+        REQUIRE(h1.IsNull() != true);
+        CHECK(h0 != h1);
+        CHECK(pool.Get(h0)->id == 1);
+        CHECK(pool.Get(h1)->id == 2);
+        CHECK(IsAligned(RCAST(memptr, pool.Get(h1)), pool.BlockAlign));
+
+        pool.Destruct(h0);
+        pool.Destruct(h1);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Stale handles")
+    {
+        THandle<Entity> h0 = pool.Construct<Entity>();
+        pool.Destruct(h0);
+
+        CHECK(pool.IsValid(h0) == false);
+        CHECK(pool.Get(h0) == nullptr);
+
+        // the entry == reused with a new generation
+        THandle<Entity> h1 = pool.Construct<Entity>();
+        CHECK(h1.index == h0.index);
+        CHECK(h1.generation != h0.generation);
+        CHECK(pool.Get(h0) == nullptr);
+
+        pool.Destruct(h0);
+        CHECK(pool.IsValid(h1));
+        CHECK(pool.Get(THandle<Entity>{ }) == nullptr);
+    }
+
+    SECTION("Defragment moves blocks over holes")
+    {
+        std::vector<THandle<void>> handles;
+        for (sizet i = 0; i < 20; i++)
+        {
+            THandle<void> handle = pool.AllocateRaw(16 + i * 8);
+            REQUIRE(handle.IsNull() != true);
+            memset(pool.GetRaw(handle), SCAST(int, i), 16 + i * 8);
+            handles.push_back(handle);
+        }
+
+        sizet usedCount = pool.UsedCount();
+        for (sizet i = 0; i < 20; i += 2)
+        {
+            pool.DeallocateRaw(handles[i]);
+        }
+
+        CHECK(pool.HoleCount() > 0);
+        CHECK(pool.UsedCount() < usedCount);
+
+        // a small budget moves a few blocks only
+        CHECK(pool.Defragment(1) > 0);
+        CHECK(pool.HoleCount() > 0);
+
+        while (pool.HoleCount() > 0)
+        {
+            pool.Defragment(64);
+        }
+
+        CHECK(pool.FreeCount() == pool.Size() - pool.UsedCount());
+        for (sizet i = 1; i < 20; i += 2)
+        {
+            memptr mem = pool.GetRaw(handles[i]);
+            REQUIRE(mem != nullptr);
+            CHECK(SCAST(sizet, mem[0]) == i);
+            CHECK(SCAST(sizet, mem[16 + i * 8 - 1]) == i);
+        }
+
+        // blocks are packed from the start, so the next block follows all used memory
+        usedCount = pool.UsedCount();
+        THandle<void> next = pool.AllocateRaw(16);
+        CHECK(pool.GetRaw(next) == pool.GetRaw(handles[1]) + usedCount);
+    }
+
+    SECTION("Deallocation between defragment steps")
+    {
+        std::vector<THandle<void>> handles;
+        for (sizet i = 0; i < 30; i++)
+        {
+            THandle<void> handle = pool.AllocateRaw(32);
+            memset(pool.GetRaw(handle), SCAST(int, i), 32);
+            handles.push_back(handle);
+        }
+
+        for (sizet i = 0; i < 30; i += 3)
+        {
+            pool.DeallocateRaw(handles[i]);
+            handles[i] = { };
+        }
+
+        pool.Defragment(100);
+
+        // free blocks before, around and after the compaction cursor, and the top block
+        for (sizet i : { 1, 14, 28, 29 })
+        {
+            pool.DeallocateRaw(handles[i]);
+            handles[i] = { };
+        }
+
+        handles.push_back(pool.AllocateRaw(32));
+        memset(pool.GetRaw(handles.back()), 30, 32);
+
+        pool.Defragment(std::chrono::milliseconds(100));
+        CHECK(pool.HoleCount() == 0);
+
+        sizet usedCount = 0;
+        for (sizet i = 0; i < handles.size(); i++)
+        {
+            if (handles[i].IsNull()) continue;
+
+            memptr mem = pool.GetRaw(handles[i]);
+            REQUIRE(mem != nullptr);
+            CHECK(SCAST(sizet, mem[31]) == i);
+            usedCount += 32 + 16;
+        }
+
+        CHECK(pool.UsedCount() == usedCount);
+    }
+
+    SECTION("Allocation compacts when holes fit the request, else grows")
+    {
+        sizet size = pool.Size();
+
+        std::vector<THandle<void>> handles;
+        while (pool.FreeCount() >= 256 + 64)
+        {
+            handles.push_back(pool.AllocateRaw(256));
+        }
+
+        for (sizet i = 0; i < handles.size(); i += 2)
+        {
+            pool.DeallocateRaw(handles[i]);
+        }
+
+        THandle<void> large = pool.AllocateRaw(512);
+        REQUIRE(large.IsNull() != true);
+        CHECK(pool.Size() == size);
+        CHECK(pool.HoleCount() == 0);
+
+        THandle<void> huge = pool.AllocateRaw(size * 2);
+        REQUIRE(huge.IsNull() != true);
+        CHECK(pool.Size() > size * 2);
+        CHECK(pool.IsValid(large));
+    }
+}
\ No newline at end of file
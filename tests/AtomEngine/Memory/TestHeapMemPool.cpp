@@ -0,0 +1,168 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+
+using namespace Atom;
+
+TEST_CASE("HeapMemPool")
+{
+    HeapMemPool pool(1024);
+    REQUIRE(pool.Size() >= 1024);
+
+    SECTION("Allocation")
+    {
+        memptr mem0 = pool.AllocateRaw(100);
+        memptr mem1 = pool.AllocateRaw(200);
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        CHECK(mem0 != mem1);
+        CHECK(pool.UsedCount() >= 300);
+
+        pool.DeallocateRaw(mem0, 100);
+        pool.DeallocateRaw(mem1, 200);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Freed blocks are joined")
+    {
+        memptr mem0 = pool.AllocateRaw(300);
+        memptr mem1 = pool.AllocateRaw(300);
+        memptr mem2 = pool.AllocateRaw(300);
+
+        pool.DeallocateRaw(mem0, 300);
+        pool.DeallocateRaw(mem2, 300);
+        pool.DeallocateRaw(mem1, 300);
+
+        CHECK(pool.HasBlockFor(pool.Size()));
+    }
+
+    SECTION("Reallocation keeps contents")
+    {
+        memptr mem = pool.AllocateRaw(16);
+        for (sizet i = 0; i < 16; i++)
+        {
+            mem[i] = i;
+        }
+
+        pool.AllocateRaw(16);
+        mem = pool.ReallocateRaw(mem, 4096);
+
+        REQUIRE(mem != nullptr);
+        for (sizet i = 0; i < 16; i++)
+        {
+            CHECK(SCAST(sizet, mem[i]) == i);
+        }
+
+        CHECK(SCAST(sizet, mem[4095]) == 0);
+    }
+
+    SECTION("Aligned allocation")
+    {
+        struct alignas(64) CacheLine
+        {
+            byte data[64];
+        };
+
+        for (sizet align : { 32, 64, 256, 4096 })
+        {
+            memptr mem = pool.AllocateAligned(100, align);
+
+            REQUIRE(mem != nullptr);
+            CHECK(IsAligned(mem, align));
+        }
+
+        CacheLine* lines = pool.Allocate<CacheLine>(4);
+        REQUIRE(lines != nullptr);
+        CHECK(IsAligned(lines, 64));
+
+        lines = pool.Reallocate(lines, 100);
+        REQUIRE(lines != nullptr);
+        CHECK(IsAligned(lines, 64));
+    }
+
+    SECTION("Grows when out of memory")
+    {
+        memptr mem = pool.AllocateRaw(pool.Size() * 4);
+
+        CHECK(mem != nullptr);
+    }
+
+    SECTION("Shrink releases free chunks")
+    {
+        sizet size = pool.Size();
+        memptr mem = pool.AllocateRaw(size * 4);
+        REQUIRE(mem != nullptr);
+        REQUIRE(pool.Size() > size * 4);
+
+        pool.Shrink();
+        CHECK(pool.Size() > size * 4);
+
+        pool.DeallocateRaw(mem, size * 4);
+        pool.Shrink();
+        CHECK(pool.Size() < size * 4);
+
+        mem = pool.AllocateRaw(size * 4);
+        CHECK(mem != nullptr);
+    }
+
+    SECTION("Shrink hysteresis")
+    {
+        sizet size = pool.Size();
+        memptr mem = pool.AllocateRaw(size * 4);
+        REQUIRE(mem != nullptr);
+        pool.DeallocateRaw(mem, size * 4);
+
+        sizet grownSize = pool.Size();
+        pool.SetShrinkHysteresis(grownSize, 0);
+        pool.Shrink();
+        CHECK(pool.Size() == grownSize);
+
+        pool.SetShrinkHysteresis(0, size * 4);
+        pool.Shrink();
+        CHECK(pool.FreeCount() >= size * 4);
+
+        pool.SetShrinkHysteresis(0, 0);
+        pool.Shrink();
+        CHECK(pool.Size() < size * 4);
+    }
+    SECTION("Batch allocation")
+    {
+        memptr mems[100];
+        REQUIRE(pool.AllocateBatch(24, 100, mems));
+
+        for (sizet i = 0; i < 100; i++)
+        {
+            REQUIRE(mems[i] != nullptr);
+            CHECK(SCAST(sizet, mems[i][23]) == 0);
+            memset(mems[i], SCAST(int, i), 24);
+        }
+
+        // the batch == divided off a single block, so blocks follow each other
+        for (sizet i = 1; i < 100; i++)
+        {
+            CHECK(mems[i] > mems[i - 1]);
+        }
+
+        for (sizet i = 0; i < 100; i++)
+        {
+            CHECK(SCAST(sizet, mems[i][0]) == i);
+            CHECK(SCAST(sizet, mems[i][23]) == i);
+        }
+
+        pool.DeallocateRaw(mems[50], 24);
+        mems[50] = nullptr;
+        pool.DeallocateBatch(mems, 100, 24);
+        CHECK(pool.UsedCount() == 0);
+
+        memptr* aligned = RCAST(memptr*, pool.AllocateRaw(sizeof(memptr) * 10));
+        REQUIRE(pool.AllocateBatch(100, 10, aligned, true, 64));
+        for (sizet i = 0; i < 10; i++)
+        {
+            CHECK(IsAligned(aligned[i], 64));
+        }
+
+        pool.DeallocateBatch(aligned, 10);
+        pool.DeallocateRaw(RCAST(memptr, aligned), 0);
+        CHECK(pool.UsedCount() == 0);
+    }
+}
\ No newline at end of file
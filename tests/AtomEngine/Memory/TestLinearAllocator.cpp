@@ -0,0 +1,124 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+
+using namespace Atom;
+
+TEST_CASE("LinearAllocator")
+{
+    LinearAllocator allocator(1024);
+    REQUIRE(allocator.Size() == 1024);
+
+    SECTION("Allocation")
+    {
+        memptr mem0 = allocator.AllocateRaw(10);
+        memptr mem1 = allocator.AllocateRaw(10);
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        CHECK(mem1 == mem0 + allocator.Align + allocator.BlockHeaderSize);
+        CHECK(RCAST(sizet, mem1) % allocator.Align == 0);
+        CHECK(allocator.UsedCount() == 2 * (allocator.Align + allocator.BlockHeaderSize));
+
+        CHECK(allocator.AllocateRaw(allocator.FreeCount() + 1) == nullptr);
+    }
+
+    SECTION("Aligned allocation")
+    {
+        allocator.AllocateRaw(10);
+        memptr mem = allocator.AllocateAligned(10, 64);
+
+        REQUIRE(mem != nullptr);
+        CHECK(IsAligned(mem, 64));
+    }
+
+    SECTION("Reset frees all allocations")
+    {
+        memptr mem = allocator.AllocateRaw(100);
+        allocator.AllocateRaw(100);
+        allocator.DeallocateRaw(mem, 100);
+        CHECK(allocator.UsedCount() != 0);
+
+        allocator.Reset();
+        CHECK(allocator.UsedCount() == 0);
+        CHECK(allocator.AllocateRaw(100) == mem);
+    }
+
+    SECTION("Reallocation of the last allocation")
+    {
+        memptr mem = allocator.AllocateRaw(16);
+        for (sizet i = 0; i < 16; i++)
+        {
+            mem[i] = i;
+        }
+
+        CHECK(allocator.ReallocateRaw(mem, 512) == mem);
+        CHECK(allocator.UsedCount() == allocator.BlockHeaderSize + 512);
+        CHECK(SCAST(sizet, mem[15]) == 15);
+        CHECK(SCAST(sizet, mem[511]) == 0);
+
+        CHECK(allocator.ReallocateRaw(mem, 32) == mem);
+        CHECK(allocator.UsedCount() == allocator.BlockHeaderSize + 32);
+    }
+
+    SECTION("Reallocation of older allocations")
+    {
+        memptr mem0 = allocator.AllocateRaw(16);
+        for (sizet i = 0; i < 16; i++)
+        {
+            mem0[i] = i;
+        }
+
+        allocator.AllocateRaw(16);
+        memptr mem1 = allocator.ReallocateRaw(mem0, 64);
+
+        REQUIRE(mem1 != nullptr);
+        CHECK(mem1 != mem0);
+        for (sizet i = 0; i < 16; i++)
+        {
+            CHECK(SCAST(sizet, mem1[i]) == i);
+        }
+    }
+
+    SECTION("Reallocation of a middle allocation keeps its neighbours")
+    {
+        memptr mem0 = allocator.AllocateRaw(16);
+        memptr mem1 = allocator.AllocateRaw(16);
+        memptr mem2 = allocator.AllocateRaw(16);
+        memset(mem1, 1, 16);
+        mem2[0] = 2;
+
+        memptr mem = allocator.ReallocateRaw(mem0, 32);
+        REQUIRE(mem != nullptr);
+        CHECK(mem != mem0);
+        for (sizet i = 16; i < 32; i++)
+        {
+            CHECK(SCAST(sizet, mem[i]) == 0);
+        }
+
+        memset(mem, 0xff, 32);
+        CHECK(SCAST(sizet, mem1[0]) == 1);
+        CHECK(SCAST(sizet, mem2[0]) == 2);
+
+        // shrinks in place
+        CHECK(allocator.ReallocateRaw(mem1, 8) == mem1);
+        CHECK(SCAST(sizet, mem1[0]) == 1);
+        CHECK(SCAST(sizet, mem2[0]) == 2);
+    }
+
+    SECTION("Batch allocation")
+    {
+        memptr mems[4];
+        REQUIRE(allocator.AllocateBatch(10, 4, mems));
+        for (sizet i = 1; i < 4; i++)
+        {
+            CHECK(mems[i] == mems[i - 1] + allocator.Align + allocator.BlockHeaderSize);
+        }
+
+        // a batch which does not fit takes no memory
+        sizet usedCount = allocator.UsedCount();
+        memptr large[4];
+        CHECK(allocator.AllocateBatch(allocator.FreeCount() / 2, 4, large) == false);
+        CHECK(large[0] == nullptr);
+        CHECK(allocator.UsedCount() == usedCount);
+    }
+}
\ No newline at end of file
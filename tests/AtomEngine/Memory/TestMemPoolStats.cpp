@@ -0,0 +1,149 @@
+#include <thread>
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/ObjectPool.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+
+using namespace Atom;
+
+TEST_CASE("MemPoolStats")
+{
+    SECTION("Histogram buckets")
+    {
+        CHECK(MemPoolStats::HistogramIndex(0) == 0);
+        CHECK(MemPoolStats::HistogramIndex(1) == 1);
+        CHECK(MemPoolStats::HistogramIndex(2) == 2);
+        CHECK(MemPoolStats::HistogramIndex(3) == 2);
+        CHECK(MemPoolStats::HistogramIndex(1024) == 11);
+        CHECK(MemPoolStats::HistogramIndex(NPOS) == MemPoolStats::HistogramCount - 1);
+    }
+
+    SECTION("HeapMemPool")
+    {
+        HeapMemPool pool(4096);
+        IMemPool& base = pool;
+
+        memptr mem0 = pool.AllocateRaw(100);
+        memptr mem1 = pool.AllocateRaw(200);
+        memptr mem2 = pool.AllocateRaw(300);
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        REQUIRE(mem2 != nullptr);
+
+        mem2 = pool.ReallocateRaw(mem2, 400);
+        REQUIRE(mem2 != nullptr);
+
+        sizet peak = pool.UsedCount();
+        pool.DeallocateRaw(mem1, 200);
+
+        MemPoolStats stats = base.Stats();
+        CHECK(stats.size == pool.Size());
+        CHECK(stats.usedCount == pool.UsedCount());
+        CHECK(stats.FreeCount() == pool.FreeCount());
+        CHECK(stats.freeBlockCount >= 2);
+        CHECK(stats.largestFreeBlock < stats.FreeCount());
+        CHECK(stats.Fragmentation() > 0);
+        CHECK(stats.Fragmentation() < 1);
+
+    #if ATOM_MEMORY_STATS
+        CHECK(stats.allocCount >= 3);
+        CHECK(stats.deallocCount >= 1);
+        CHECK(stats.reallocCount == 1);
+        CHECK(stats.peakUsedCount == peak);
+        CHECK(stats.allocBytes - stats.deallocBytes == stats.usedCount);
+        CHECK(stats.histogram[MemPoolStats::HistogramIndex(100)] == 1);
+        CHECK(stats.histogram[MemPoolStats::HistogramIndex(200)] == 1);
+    #endif
+
+        pool.DeallocateRaw(mem0, 100);
+        pool.DeallocateRaw(mem2, 400);
+
+        stats = pool.Stats();
+        CHECK(stats.usedCount == 0);
+        CHECK(stats.freeBlockCount == 1);
+        CHECK(stats.largestFreeBlock == stats.FreeCount());
+        CHECK(stats.Fragmentation() == 0);
+
+        pool.ResetStats();
+        stats = pool.Stats();
+        CHECK(stats.allocCount == 0);
+        CHECK(stats.peakUsedCount == 0);
+    }
+
+    SECTION("ObjectPool")
+    {
+        TObjectPool<sizet> pool;
+        memptr mem = pool.AllocateRaw(sizeof(sizet));
+        REQUIRE(mem != nullptr);
+
+        MemPoolStats stats = pool.Stats();
+        CHECK(stats.usedCount == pool.UsedCount());
+        CHECK(stats.freeBlockCount * pool.SlotSize == pool.FreeCount());
+
+    #if ATOM_MEMORY_STATS
+        CHECK(stats.allocCount == 1);
+        CHECK(stats.peakUsedCount == pool.SlotSize);
+    #endif
+
+        pool.DeallocateRaw(mem, sizeof(sizet));
+    }
+
+    SECTION("LinearAllocator")
+    {
+        LinearAllocator allocator(1024);
+        allocator.AllocateRaw(100);
+        allocator.AllocateRaw(100);
+
+        MemPoolStats stats = allocator.Stats();
+        CHECK(stats.usedCount == allocator.UsedCount());
+        CHECK(stats.largestFreeBlock == allocator.FreeCount());
+        CHECK(stats.Fragmentation() == 0);
+
+    #if ATOM_MEMORY_STATS
+        CHECK(stats.allocCount == 2);
+        CHECK(stats.allocBytes == allocator.UsedCount());
+    #endif
+
+        allocator.Reset();
+        stats = allocator.Stats();
+        CHECK(stats.usedCount == 0);
+
+    #if ATOM_MEMORY_STATS
+        CHECK(stats.peakUsedCount >= 200);
+    #endif
+    }
+
+#if ATOM_MEMORY_STATS
+    SECTION("Counters polled from another thread")
+    {
+        HeapMemPool pool(4096);
+        std::atomic<bool> done = false;
+        bool consistent = true;
+        std::thread poller([&]
+        {
+            MemPoolStats stats;
+            while (done.load() != true)
+            {
+                pool.Counters().Read(stats);
+                consistent = consistent and stats.deallocCount <= stats.allocCount;
+            }
+        });
+
+        for (sizet i = 0; i < 1000; i++)
+        {
+            memptr mem = pool.AllocateRaw(64);
+            REQUIRE(mem != nullptr);
+            pool.DeallocateRaw(mem, 64);
+        }
+
+        done = true;
+        poller.join();
+        CHECK(consistent);
+
+        MemPoolStats stats;
+        pool.Counters().Read(stats);
+        CHECK(stats.allocCount == pool.Stats().allocCount);
+        CHECK(stats.deallocCount == 1000);
+    }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/LinearAllocator.hpp"
+#include "AtomEngine/Memory/MemoryTag.hpp"
+
+using namespace Atom;
+
+/// Evicts the cache of the test, passed as user data.
+static void EvictCache(MemoryTag& tag, sizet size, void* userData)
+{
+    memptr* cache = RCAST(memptr*, userData);
+    tag.DeallocateRaw(*cache, 0);
+    *cache = nullptr;
+}
+
+TEST_CASE("MemoryTag")
+{
+    TMemoryTag<HeapMemPool> tag("Test/Audio", 64 * 1024, 256 * 1024);
+
+    SECTION("Usage and peak")
+    {
+        MemoryTag::Usage start = tag.GetUsage();
+
+        memptr mem = tag.AllocateRaw(1000);
+        memptr mem2 = tag.AllocateRaw(2000);
+        MemoryTag::Usage usage = tag.GetUsage();
+        CHECK(usage.usedCount >= start.usedCount + 3000);
+        CHECK(usage.allocCount == 2);
+
+        tag.DeallocateRaw(mem2, 2000);
+        usage = tag.GetUsage();
+        CHECK(usage.usedCount < usage.peakUsedCount);
+        CHECK(usage.peakUsedCount >= start.usedCount + 3000);
+
+        tag.ResetPeak();
+        CHECK(tag.GetUsage().peakUsedCount == tag.GetUsage().usedCount);
+
+        tag.DeallocateRaw(mem, 1000);
+        CHECK(tag.GetUsage().usedCount == start.usedCount);
+    }
+
+    SECTION("Registered tags")
+    {
+        TMemoryTag<LinearAllocator> arena("Test/Streaming", NPOS, 1024);
+        arena.AllocateRaw(100);
+
+        CHECK(MemoryTag::Find("Test/Audio") == &tag);
+        CHECK(MemoryTag::Find("Test/Streaming") == &arena);
+        CHECK(MemoryTag::Find("Test/None") == nullptr);
+
+        MemoryTag::Usage usages[8];
+        sizet count = MemoryTag::GetAllUsage(usages, 8);
+        REQUIRE(count >= 2);
+        CHECK(strcmp(usages[0].name, "Test/Streaming") == 0);
+        CHECK(usages[0].usedCount >= 100);
+        CHECK(usages[0].budget == NPOS);
+    }
+
+    SECTION("Over budget function evicts memory")
+    {
+        memptr cache = tag.AllocateRaw(48 * 1024);
+        tag.SetOverBudgetFunc(EvictCache, &cache);
+
+        memptr mem = tag.AllocateRaw(32 * 1024);
+        CHECK(mem != nullptr);
+        CHECK(cache == nullptr);
+
+        MemoryTag::Usage usage = tag.GetUsage();
+        CHECK(usage.overBudgetCount == 1);
+        CHECK(usage.usedCount <= usage.budget);
+
+        tag.DeallocateRaw(mem, 0);
+    }
+
+    SECTION("Over budget function == called once per crossing")
+    {
+        sizet callCount = 0;
+        tag.SetOverBudgetFunc([](MemoryTag& tag, sizet size, void* userData)
+        {
+            (*RCAST(sizet*, userData))++;
+        }, &callCount);
+
+        memptr mems[4];
+        for (memptr& mem : mems)
+        {
+            mem = tag.AllocateRaw(24 * 1024);
+        }
+
+        CHECK(callCount == 1);
+
+        for (memptr mem : mems)
+        {
+            tag.DeallocateRaw(mem, 0);
+        }
+
+        mems[0] = tag.AllocateRaw(80 * 1024);
+        CHECK(callCount == 2);
+        tag.DeallocateRaw(mems[0], 0);
+    }
+}
\ No newline at end of file
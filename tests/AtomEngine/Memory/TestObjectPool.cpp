@@ -0,0 +1,186 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ObjectPool.hpp"
+#include "AtomEngine/Memory/UniquePtr.hpp"
+#include "AtomEngine/Memory/SharedPtr.hpp"
+
+using namespace Atom;
+
+struct Particle
+{
+    float position[3];
+    float velocity[3];
+    int life;
+};
+
+TEST_CASE("TObjectPool")
+{
+    TObjectPool<Particle, 8> pool;
+    REQUIRE(pool.Size() == 0);
+
+    SECTION("Allocation")
+    {
+        Particle* p0 = pool.Allocate<Particle>();
+        Particle* p1 = pool.Allocate<Particle>();
+
+        REQUIRE(p0 != nullptr);
+        REQUIRE(p1 != nullptr);
+        CHECK(p0 != p1);
+        CHECK(pool.UsedCount() == 2 * pool.SlotSize);
+        CHECK(pool.Size() == 8 * pool.SlotSize);
+
+        CHECK(pool.AllocateRaw(0) == nullptr);
+        CHECK(pool.AllocateRaw(pool.SlotSize + 1) == nullptr);
+        CHECK(pool.AllocateRaw(sizeof(Particle), true, pool.SlotAlign * 2) == nullptr);
+
+        // Particle == aligned to less than DefaultAlign, slots are not
+        IAllocator& allocator = pool;
+        memptr mems[3];
+        for (memptr& mem : mems)
+        {
+            mem = allocator.AllocateRaw(sizeof(Particle));
+            REQUIRE(mem != nullptr);
+            CHECK(IsAligned(mem, DefaultAlign));
+        }
+
+        for (memptr mem : mems)
+        {
+            allocator.DeallocateRaw(mem, sizeof(Particle));
+        }
+
+        pool.Deallocate(p0);
+        pool.Deallocate(p1);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Freed slots are reused")
+    {
+        Particle* p0 = pool.Allocate<Particle>();
+        pool.Deallocate(p0);
+
+        CHECK(pool.Allocate<Particle>() == p0);
+    }
+
+    SECTION("Grows geometrically")
+    {
+        Particle* particles[20];
+        for (Particle*& p : particles)
+        {
+            p = pool.Construct<Particle>();
+            REQUIRE(p != nullptr);
+            CHECK(p->life == 0);
+        }
+
+        // pages of 8, 8 and 16 slots
+        CHECK(pool.Size() == 32 * pool.SlotSize);
+
+        pool.ReserveMore(pool.SlotSize * 10);
+        CHECK(pool.Size() == 42 * pool.SlotSize);
+
+        for (Particle* p : particles)
+        {
+            pool.Destruct(p);
+        }
+    }
+
+    SECTION("Shrink releases free pages")
+    {
+        Particle* particles[16];
+        for (Particle*& p : particles)
+        {
+            p = pool.Allocate<Particle>();
+        }
+
+        for (sizet i = 0; i < 8; i++)
+        {
+            pool.Deallocate(particles[i]);
+        }
+
+        pool.Shrink();
+        CHECK(pool.Size() == 8 * pool.SlotSize);
+        CHECK(pool.FreeCount() == 0);
+
+        for (sizet i = 8; i < 16; i++)
+        {
+            pool.Deallocate(particles[i]);
+        }
+
+        pool.Shrink();
+        CHECK(pool.Size() == 0);
+    }
+
+    SECTION("Shrink keeps pages with used slots")
+    {
+        // pages of 8, 8, 16 and 32 slots
+        Particle* particles[64];
+        for (Particle*& p : particles)
+        {
+            p = pool.Allocate<Particle>();
+        }
+
+        REQUIRE(pool.Size() == 64 * pool.SlotSize);
+
+        // frees the second and last page, and all but one slot of the third page
+        for (sizet i = 8; i < 64; i++)
+        {
+            if (i != 20) pool.Deallocate(particles[i]);
+        }
+
+        pool.Shrink();
+        CHECK(pool.Size() == 24 * pool.SlotSize);
+        CHECK(pool.UsedCount() == 9 * pool.SlotSize);
+
+        // free slots are relinked in address order
+        Particle* prev = pool.Allocate<Particle>();
+        for (sizet i = 1; i < 15; i++)
+        {
+            Particle* p = pool.Allocate<Particle>();
+            CHECK(p > prev);
+            prev = p;
+        }
+
+        CHECK(pool.FreeCount() == 0);
+    }
+
+    SECTION("Smart pointers")
+    {
+        {
+            TUniquePtr<Particle> unique(pool.Construct<Particle>(), pool);
+            TSharedPtr<Particle> shared(pool.Construct<Particle>(), pool);
+            TSharedPtr<Particle> sharedCopy = shared;
+
+            CHECK(pool.UsedCount() == 2 * pool.SlotSize);
+        }
+
+        CHECK(pool.UsedCount() == 0);
+    }
+    SECTION("Batch allocation")
+    {
+        Particle* particles[20];
+        REQUIRE(pool.ConstructBatch(particles, 20));
+        CHECK(pool.Size() == 20 * pool.SlotSize);
+        CHECK(pool.UsedCount() == 20 * pool.SlotSize);
+
+        for (Particle* p : particles)
+        {
+            REQUIRE(p != nullptr);
+            CHECK(p->life == 0);
+        }
+
+        pool.DestructBatch(particles, 20);
+        CHECK(pool.UsedCount() == 0);
+
+        // slots come back in the same order
+        Particle* again[20];
+        REQUIRE(pool.ConstructBatch(again, 20));
+        for (sizet i = 0; i < 20; i++)
+        {
+            CHECK(again[i] == particles[i]);
+        }
+
+        pool.DestructBatch(again, 20);
+
+        memptr mems[2];
+        CHECK(pool.AllocateBatch(sizeof(Particle) * 2, 2, mems) == false);
+        CHECK(mems[0] == nullptr);
+    }
+}
\ No newline at end of file
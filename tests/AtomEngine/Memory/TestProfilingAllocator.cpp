@@ -0,0 +1,221 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+#include "AtomEngine/Memory/ProfilingAllocator.hpp"
+
+using namespace Atom;
+
+/// Finds the site with tag \p{tag}, nullptr if not found.
+static const ProfilingAllocator::Site* FindSite(const ProfilingAllocator& profiler, const char* tag)
+{
+    for (sizet i = 0; i < profiler.SiteCapacity(); i++)
+    {
+        const ProfilingAllocator::Site& site = profiler.GetSite(i);
+        if (site.isReady and site.tag != nullptr and strcmp(site.tag, tag) == 0)
+        {
+            return &site;
+        }
+    }
+
+    return nullptr;
+}
+
+/// Reads whole content of \p{file}.
+static std::string ReadFile(FILE* file)
+{
+    std::string content;
+    rewind(file);
+
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), file) != nullptr)
+    {
+        content += buffer;
+    }
+
+    return content;
+}
+
+TEST_CASE("ProfilingAllocator")
+{
+    HeapMemPool pool(4096);
+
+    SECTION("Aggregates allocations by tag")
+    {
+        ProfilingAllocator profiler(pool, 0);
+        sizet usedCount = pool.UsedCount();
+        memptr mem0 = nullptr;
+        memptr mem1 = nullptr;
+        memptr mem2 = nullptr;
+
+        {
+            ProfilingAllocator::TagScope scope("Physics");
+            mem0 = profiler.AllocateRaw(100);
+            mem1 = profiler.AllocateRaw(200);
+
+            {
+                ProfilingAllocator::TagScope innerScope("Audio");
+                mem2 = profiler.AllocateRaw(50);
+            }
+        }
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        REQUIRE(mem2 != nullptr);
+
+        profiler.DeallocateRaw(mem0, 100);
+
+        const ProfilingAllocator::Site* physics = FindSite(profiler, "Physics");
+        REQUIRE(physics != nullptr);
+        CHECK(physics->allocCount == 2);
+        CHECK(physics->allocBytes == 300);
+        CHECK(physics->deallocCount == 1);
+        CHECK(physics->deallocBytes == 100);
+
+        const ProfilingAllocator::Site* audio = FindSite(profiler, "Audio");
+        REQUIRE(audio != nullptr);
+        CHECK(audio->allocCount == 1);
+        CHECK(audio->allocBytes == 50);
+
+        profiler.DeallocateRaw(mem1, 200);
+        profiler.DeallocateRaw(mem2, 50);
+        CHECK(pool.UsedCount() == usedCount);
+    }
+
+    SECTION("Keeps alignment and contents")
+    {
+        ProfilingAllocator profiler(pool, 0);
+        sizet usedCount = pool.UsedCount();
+
+        for (sizet align : { 16, 64, 256 })
+        {
+            memptr mem = profiler.AllocateRaw(100, true, align);
+            REQUIRE(mem != nullptr);
+            CHECK(IsAligned(mem, align));
+
+            for (sizet i = 0; i < 100; i++)
+            {
+                mem[i] = i;
+            }
+
+            mem = profiler.ReallocateRaw(mem, 1000, true, false, align);
+            REQUIRE(mem != nullptr);
+            CHECK(IsAligned(mem, align));
+            CHECK(SCAST(sizet, mem[99]) == 99);
+            CHECK(SCAST(sizet, mem[999]) == 0);
+
+            mem = profiler.ReallocateRaw(mem, 2000, true, false, align * 2);
+            REQUIRE(mem != nullptr);
+            CHECK(IsAligned(mem, align * 2));
+            CHECK(SCAST(sizet, mem[99]) == 99);
+
+            profiler.DeallocateRaw(mem, 2000);
+        }
+
+        CHECK(pool.UsedCount() == usedCount);
+    }
+
+    SECTION("Samples allocations")
+    {
+        ProfilingAllocator profiler(pool, 0, 4);
+        ProfilingAllocator::TagScope scope("Sampled");
+
+        memptr mems[16];
+        for (memptr& mem : mems)
+        {
+            mem = profiler.AllocateRaw(16);
+        }
+
+        const ProfilingAllocator::Site* site = FindSite(profiler, "Sampled");
+        REQUIRE(site != nullptr);
+        CHECK(site->allocCount == 4);
+
+        for (memptr mem : mems)
+        {
+            profiler.DeallocateRaw(mem, 16);
+        }
+
+        CHECK(site->deallocCount == 4);
+    }
+
+    SECTION("Captures call stacks")
+    {
+        ProfilingAllocator profiler(pool, 4);
+
+        memptr mem = profiler.AllocateRaw(64);
+        REQUIRE(mem != nullptr);
+        profiler.DeallocateRaw(mem, 64);
+
+        sizet siteCount = 0;
+        for (sizet i = 0; i < profiler.SiteCapacity(); i++)
+        {
+            const ProfilingAllocator::Site& site = profiler.GetSite(i);
+            if (site.isReady and site.allocCount > 0)
+            {
+                siteCount++;
+                CHECK(site.frameCount > 0);
+            }
+        }
+
+        CHECK(siteCount == 1);
+    }
+
+    SECTION("Writes reports")
+    {
+        ProfilingAllocator profiler(pool, 2);
+        memptr mem = nullptr;
+
+        {
+            ProfilingAllocator::TagScope scope("Render");
+            mem = profiler.AllocateRaw(128);
+        }
+
+        FILE* file = tmpfile();
+        REQUIRE(file != nullptr);
+
+        profiler.WriteReport(file);
+        std::string report = ReadFile(file);
+        CHECK(report.find("[Render]") != std::string::npos);
+        CHECK(report.find("128") != std::string::npos);
+        fclose(file);
+
+        file = tmpfile();
+        REQUIRE(file != nullptr);
+
+        profiler.WriteFoldedStacks(file);
+        std::string folded = ReadFile(file);
+        CHECK(folded.rfind("Render;", 0) == 0);
+        CHECK(folded.find(" 128\n") != std::string::npos);
+        fclose(file);
+
+        profiler.DeallocateRaw(mem, 128);
+    }
+    SECTION("Batch allocation captures the call site once")
+    {
+        ProfilingAllocator profiler(pool, 0);
+        sizet usedCount = pool.UsedCount();
+
+        memptr mems[10];
+        {
+            ProfilingAllocator::TagScope scope("Particles");
+            REQUIRE(profiler.AllocateBatch(40, 10, mems, true, 32));
+        }
+
+        for (memptr mem : mems)
+        {
+            CHECK(IsAligned(mem, 32));
+            CHECK(SCAST(sizet, mem[39]) == 0);
+        }
+
+        const ProfilingAllocator::Site* particles = FindSite(profiler, "Particles");
+        REQUIRE(particles != nullptr);
+        CHECK(particles->allocCount == 10);
+        CHECK(particles->allocBytes == 400);
+
+        profiler.DeallocateBatch(mems, 10, 40);
+        CHECK(particles->deallocCount == 10);
+        CHECK(pool.UsedCount() == usedCount);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/RecyclePool.hpp"
+
+using namespace Atom;
+
+/// Owns a buffer, which Reset() keeps.
+struct RecycleItem
+{
+    RecycleItem(int id = 0): id(id)
+    {
+        constructCount++;
+    }
+
+    ~RecycleItem()
+    {
+        destructCount++;
+    }
+
+    void Reset()
+    {
+        id = 0;
+        values.Clear();
+    }
+
+    int id;
+    DynamicArray<int> values;
+
+    static inline int constructCount = 0;
+    static inline int destructCount = 0;
+};
+
+TEST_CASE("TRecyclePool")
+{
+    RecycleItem::constructCount = 0;
+    RecycleItem::destructCount = 0;
+
+    TRecyclePool<RecycleItem> pool(2);
+    REQUIRE(pool.Capacity() == 2);
+
+    SECTION("Released objects are reused with their buffers")
+    {
+        RecycleItem* item = pool.Acquire(7);
+        REQUIRE(item != nullptr);
+        CHECK(item->id == 7);
+
+        item->values.InsertBack(1);
+        item->values.InsertBack(2);
+        int* buffer = item->values.Data();
+        pool.Release(item);
+
+        RecycleItem* item2 = pool.Acquire(9);
+        CHECK(item2 == item);
+        CHECK(item2->id == 0);
+        CHECK(item2->values.Count() == 0);
+
+        item2->values.InsertBack(3);
+        CHECK(item2->values.Data() == buffer);
+        CHECK(RecycleItem::constructCount == 1);
+
+        pool.Release(item2);
+    }
+
+    SECTION("Objects above capacity are destructed")
+    {
+        RecycleItem* items[3];
+        for (RecycleItem*& item : items)
+        {
+            item = pool.Acquire();
+        }
+
+        for (RecycleItem* item : items)
+        {
+            pool.Release(item);
+        }
+
+        CHECK(RecycleItem::destructCount == 1);
+
+        TRecyclePool<RecycleItem>::Stats stats = pool.GetStats();
+        CHECK(stats.acquireCount == 3);
+        CHECK(stats.reuseCount == 0);
+        CHECK(stats.releaseCount == 3);
+        CHECK(stats.discardCount == 1);
+        CHECK(stats.activeCount == 0);
+        CHECK(stats.idleCount == 2);
+
+        pool.SetCapacity(1);
+        CHECK(pool.GetStats().idleCount == 1);
+        CHECK(RecycleItem::destructCount == 2);
+
+        pool.Trim(0);
+        CHECK(pool.GetStats().idleCount == 0);
+        CHECK(RecycleItem::destructCount == 3);
+    }
+}
\ No newline at end of file
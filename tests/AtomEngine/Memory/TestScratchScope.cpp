@@ -0,0 +1,95 @@
+#include <thread>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ScratchScope.hpp"
+#include "AtomEngine/Containers/DynamicArray.hpp"
+
+using namespace Atom;
+
+/// Allocates the result from \p{out} while using scratch memory of its own.
+static memptr BuildResult(IAllocator& out)
+{
+    ScratchScope scratch(&out);
+    memptr tmp = scratch.AllocateRaw(256);
+    memset(tmp, 1, 256);
+
+    memptr result = out.AllocateRaw(64);
+    memcpy(result, tmp, 64);
+    return result;
+}
+
+TEST_CASE("ScratchScope")
+{
+    SECTION("Rollback on exit")
+    {
+        ScratchScope outer;
+        memptr mem0 = outer.AllocateRaw(100);
+        REQUIRE(mem0 != nullptr);
+        sizet usedCount = outer.Allocator().UsedCount();
+
+        memptr mem1;
+        {
+            ScratchScope inner;
+            CHECK(&inner.Allocator() == &outer.Allocator());
+
+            mem1 = inner.AllocateRaw(1000);
+            REQUIRE(mem1 != nullptr);
+            CHECK(outer.Allocator().UsedCount() > usedCount);
+        }
+
+        CHECK(outer.Allocator().UsedCount() == usedCount);
+        CHECK(outer.AllocateRaw(1000) == mem1);
+    }
+
+    SECTION("Conflicting scopes take another arena")
+    {
+        ScratchScope outer;
+        memptr result = BuildResult(outer.Allocator());
+        REQUIRE(result != nullptr);
+
+        // the inner scope did not free the result
+        CHECK(SCAST(sizet, result[63]) == 1);
+        CHECK(outer.AllocateRaw(64) != result);
+
+        ScratchScope other(&outer.Allocator());
+        CHECK(&other.Allocator() != &outer.Allocator());
+    }
+
+    SECTION("Containers")
+    {
+        ScratchScope scratch;
+        sizet usedCount = scratch.Allocator().UsedCount();
+        {
+            ScratchScope inner;
+            DynamicArray<int> values(inner.Allocator());
+            for (int i = 0; i < 1000; i++)
+            {
+                values.InsertBack(i);
+            }
+
+            CHECK(values.Count() == 1000);
+            CHECK(values[999] == 999);
+        }
+
+        CHECK(scratch.Allocator().UsedCount() == usedCount);
+    }
+
+    SECTION("Arenas per thread")
+    {
+        ScratchScope scratch;
+        const IAllocator* mainArena = &scratch.Allocator();
+
+        const IAllocator* threadArena = nullptr;
+        memptr threadMem = nullptr;
+        std::thread thread([&threadArena, &threadMem]
+        {
+            ScratchScope scratch;
+            threadArena = &scratch.Allocator();
+            threadMem = scratch.AllocateRaw(1024);
+        });
+
+        thread.join();
+        CHECK(threadArena != mainArena);
+        CHECK(threadMem != nullptr);
+    }
+}
\ No newline at end of file
@@ -6,7 +6,7 @@ using namespace Atom;
 TEST_CASE("TSharedPtr")
 {
     int value = 10;
-    TSharedPtr<int> valuePtr = &value;
+    TSharedPtr<int> valuePtr = TSharedPtr<int>::Create(value);
     TSharedPtr<int> valuePtr1 = valuePtr;
     TSharedPtr<int> valuePtr2 = valuePtr;
     TSharedPtr<int> valuePtr3 = valuePtr;
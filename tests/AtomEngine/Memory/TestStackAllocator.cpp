@@ -0,0 +1,91 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/StackAllocator.hpp"
+
+using namespace Atom;
+
+TEST_CASE("StackAllocator")
+{
+    alignas(std::max_align_t) byte buffer[1024];
+    StackAllocator allocator(buffer, sizeof(buffer));
+    REQUIRE(allocator.Size() == 1024);
+
+    SECTION("Markers")
+    {
+        memptr mem0 = allocator.AllocateRaw(100);
+        StackAllocator::Marker marker = allocator.GetMarker();
+
+        memptr mem1 = allocator.AllocateRaw(100);
+        allocator.AllocateRaw(200);
+        allocator.AllocateRaw(300);
+
+        allocator.FreeToMarker(marker);
+        CHECK(allocator.GetMarker() == marker);
+        CHECK(allocator.AllocateRaw(100) == mem1);
+
+        allocator.FreeToMarker(0);
+        CHECK(allocator.UsedCount() == 0);
+        CHECK(allocator.AllocateRaw(100) == mem0);
+    }
+
+    SECTION("Deallocation of the last allocation")
+    {
+        memptr mem0 = allocator.AllocateRaw(100);
+        memptr mem1 = allocator.AllocateRaw(100);
+
+        allocator.DeallocateRaw(mem0, 100);
+        CHECK(allocator.GetMarker() != 0);
+
+        allocator.DeallocateRaw(mem1, 100);
+        CHECK(allocator.AllocateRaw(100) == mem1);
+    }
+
+    SECTION("Deallocation in reverse order")
+    {
+        memptr mem0 = allocator.AllocateRaw(100);
+        memptr mem1 = allocator.AllocateRaw(30);
+        memptr mem2 = allocator.AllocateRaw(200);
+
+        allocator.DeallocateRaw(mem2, 200);
+        allocator.DeallocateRaw(mem1, 30);
+        CHECK(allocator.AllocateRaw(30) == mem1);
+
+        allocator.DeallocateRaw(mem1, 30);
+        allocator.DeallocateRaw(mem0, 100);
+        CHECK(allocator.UsedCount() == 0);
+    }
+
+    SECTION("Batch deallocation")
+    {
+        memptr mem0 = allocator.AllocateRaw(8);
+        sizet used = allocator.UsedCount();
+        memptr mems[4];
+
+        // without the size, only the last block == popped
+        REQUIRE(allocator.AllocateBatch(40, 4, mems));
+        allocator.DeallocateBatch(mems, 4);
+        CHECK(allocator.AllocateRaw(40) == mems[3]);
+
+        // with the size, every block of the batch == popped
+        allocator.DeallocateBatch(mems, 4, 40);
+        CHECK(allocator.UsedCount() == used);
+
+        allocator.DeallocateRaw(mem0, 8);
+        CHECK(allocator.UsedCount() == 0);
+    }
+
+    SECTION("Reallocation below the top keeps the top")
+    {
+        memptr mem0 = allocator.AllocateRaw(16);
+        memptr mem1 = allocator.AllocateRaw(16);
+        memptr mem2 = allocator.AllocateRaw(16);
+        mem1[0] = 1;
+        mem2[0] = 2;
+
+        memptr mem = allocator.ReallocateRaw(mem0, 32);
+        REQUIRE(mem != nullptr);
+        CHECK(mem != mem0);
+        memset(mem, 0xff, 32);
+        CHECK(SCAST(sizet, mem1[0]) == 1);
+        CHECK(SCAST(sizet, mem2[0]) == 2);
+    }
+}
\ No newline at end of file
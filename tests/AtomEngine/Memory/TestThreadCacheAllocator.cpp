@@ -0,0 +1,218 @@
+#include <thread>
+#include <vector>
+
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/ThreadCacheAllocator.hpp"
+#include "AtomEngine/Memory/HeapMemPool.hpp"
+
+using namespace Atom;
+
+TEST_CASE("ThreadCacheAllocator")
+{
+    HeapMemPool backend(1024);
+    ThreadCacheAllocator allocator(backend);
+
+    SECTION("Allocation")
+    {
+        memptr mem0 = allocator.AllocateRaw(24);
+        memptr mem1 = allocator.AllocateRaw(24);
+        memptr mem2 = allocator.AllocateRaw(allocator.MaxCachedSize * 4);
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        REQUIRE(mem2 != nullptr);
+        CHECK(mem0 != mem1);
+        CHECK(RCAST(sizet, mem0) % alignof(std::max_align_t) == 0);
+        CHECK(RCAST(sizet, mem2) % alignof(std::max_align_t) == 0);
+
+        allocator.DeallocateRaw(mem0, 24);
+        CHECK(allocator.AllocateRaw(24) == mem0);
+
+        allocator.DeallocateRaw(mem0, 24);
+        allocator.DeallocateRaw(mem1, 24);
+        allocator.DeallocateRaw(mem2, allocator.MaxCachedSize * 4);
+    }
+
+    SECTION("Aligned allocation")
+    {
+        memptr mem0 = allocator.AllocateAligned(24, 64);
+        memptr mem1 = allocator.AllocateAligned(allocator.MaxCachedSize * 2, 4096);
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        CHECK(IsAligned(mem0, 64));
+        CHECK(IsAligned(mem1, 4096));
+
+        mem1[0] = 1;
+        mem1 = allocator.ReallocateRaw(mem1, allocator.MaxCachedSize * 4, true, false, 4096);
+        REQUIRE(mem1 != nullptr);
+        CHECK(IsAligned(mem1, 4096));
+        CHECK(SCAST(sizet, mem1[0]) == 1);
+
+        allocator.DeallocateRaw(mem0, 24);
+        allocator.DeallocateRaw(mem1, 0);
+    }
+
+    SECTION("Reallocation keeps contents")
+    {
+        memptr mem = allocator.AllocateRaw(16);
+        for (sizet i = 0; i < 16; i++)
+        {
+            mem[i] = i;
+        }
+
+        mem = allocator.ReallocateRaw(mem, 100);
+        mem = allocator.ReallocateRaw(mem, allocator.MaxCachedSize * 2);
+
+        REQUIRE(mem != nullptr);
+        for (sizet i = 0; i < 16; i++)
+        {
+            CHECK(SCAST(sizet, mem[i]) == i);
+        }
+
+        CHECK(SCAST(sizet, mem[allocator.MaxCachedSize * 2 - 1]) == 0);
+
+        mem = allocator.ReallocateRaw(mem, allocator.MaxCachedSize * 8);
+        REQUIRE(mem != nullptr);
+        CHECK(SCAST(sizet, mem[15]) == 15);
+        CHECK(SCAST(sizet, mem[allocator.MaxCachedSize * 8 - 1]) == 0);
+
+        allocator.DeallocateRaw(mem, 0);
+    }
+
+    SECTION("Sized deallocation")
+    {
+        memptr mem0 = allocator.AllocateRaw(40);
+        memptr mem1 = allocator.AllocateRaw(200);
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+
+        // shrinking to another size class moves the block, so the new size routes it
+        mem1 = allocator.ReallocateRaw(mem1, 20);
+        REQUIRE(mem1 != nullptr);
+
+        allocator.DeallocateRaw(mem0, 40);
+        allocator.DeallocateRaw(mem1, 20);
+
+        CHECK(allocator.AllocateRaw(20) == mem1);
+        CHECK(allocator.AllocateRaw(48) == mem0);
+
+        allocator.DeallocateRaw(mem0, 48);
+        allocator.DeallocateRaw(mem1, 0);
+
+        sizet* values = allocator.Construct<sizet>(7);
+        REQUIRE(values != nullptr);
+        CHECK(*values == 7);
+        allocator.Destruct(values);
+    }
+
+    SECTION("Wrong size keeps the size class of the block")
+    {
+        // like a TUniquePtr<Base> destructing a larger Derived object
+        memptr mem = allocator.AllocateRaw(200);
+        REQUIRE(mem != nullptr);
+        allocator.DeallocateRaw(mem, 16);
+
+        memptr small = allocator.AllocateRaw(16);
+        CHECK(small != mem);
+        CHECK(allocator.AllocateRaw(200) == mem);
+
+        memptr batch[2] = { mem, small };
+        allocator.DeallocateBatch(batch, 2, 16);
+        CHECK(allocator.AllocateRaw(200) == mem);
+        allocator.DeallocateRaw(mem, 200);
+    }
+
+    SECTION("Falls back to backend when reserved range == used up")
+    {
+        ThreadCacheAllocator smallAllocator(backend, ThreadCacheAllocator::SpanCommitSize);
+
+        std::vector<memptr> blocks;
+        for (sizet i = 0; i < 20000; i++)
+        {
+            memptr mem = smallAllocator.AllocateRaw(64);
+            REQUIRE(mem != nullptr);
+            blocks.push_back(mem);
+        }
+
+        CHECK(backend.UsedCount() > 0);
+
+        for (memptr mem : blocks)
+        {
+            smallAllocator.DeallocateRaw(mem, 64);
+        }
+
+        CHECK(backend.UsedCount() == 0);
+    }
+
+    SECTION("Blocks freed on other threads")
+    {
+        constexpr sizet threadCount = 4;
+        constexpr sizet blockCount = 1000;
+
+        std::vector<memptr> blocks[threadCount];
+        std::vector<std::thread> threads;
+        for (sizet i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back([&, i]
+            {
+                for (sizet j = 0; j < blockCount; j++)
+                {
+                    memptr mem = allocator.AllocateRaw(8 + (j % 64) * 8, false);
+                    memset(mem, SCAST(int, i), 8);
+                    blocks[i].push_back(mem);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) thread.join();
+        threads.clear();
+
+        for (sizet i = 0; i < threadCount; i++)
+        {
+            for (memptr mem : blocks[i])
+            {
+                CHECK(SCAST(sizet, mem[7]) == i);
+            }
+        }
+
+        for (sizet i = 0; i < threadCount; i++)
+        {
+            // each thread frees blocks allocated by its neighbour
+            threads.emplace_back([&, i]
+            {
+                for (memptr mem : blocks[(i + 1) % threadCount])
+                {
+                    allocator.DeallocateRaw(mem, 0);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) thread.join();
+    }
+    SECTION("Batch allocation")
+    {
+        memptr mems[200];
+        REQUIRE(allocator.AllocateBatch(48, 200, mems));
+        for (sizet i = 0; i < 200; i++)
+        {
+            REQUIRE(mems[i] != nullptr);
+            CHECK(SCAST(sizet, mems[i][47]) == 0);
+            memset(mems[i], 1, 48);
+        }
+
+        allocator.DeallocateBatch(mems, 200, 48);
+
+        memptr large[4];
+        REQUIRE(allocator.AllocateBatch(allocator.MaxCachedSize * 2, 4, large));
+        CHECK(SCAST(sizet, large[3][allocator.MaxCachedSize * 2 - 1]) == 0);
+        allocator.DeallocateBatch(large, 4, allocator.MaxCachedSize * 2);
+
+        CHECK(backend.UsedCount() == 0);
+
+        sizet* values[8];
+        REQUIRE(allocator.ConstructBatch(values, 8, SCAST(sizet, 3)));
+        CHECK(*values[7] == 3);
+        allocator.DestructBatch(values, 8);
+    }
+}
\ No newline at end of file
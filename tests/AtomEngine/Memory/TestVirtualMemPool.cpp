@@ -0,0 +1,211 @@
+#include "catch2/catch_all.hpp"
+#include "AtomEngine/Memory/VirtualMemPool.hpp"
+
+using namespace Atom;
+
+TEST_CASE("VirtualMemPool")
+{
+    constexpr sizet reserveSize = 64 * 1024 * 1024;
+
+    VirtualMemPool pool(reserveSize, 1024);
+    REQUIRE(pool.ReservedCount() >= reserveSize);
+    REQUIRE(pool.Size() >= 1024);
+    CHECK(pool.CommittedCount() % GetPageSize() == 0);
+
+    SECTION("Allocation")
+    {
+        memptr mem0 = pool.AllocateRaw(100);
+        memptr mem1 = pool.AllocateRaw(200);
+
+        REQUIRE(mem0 != nullptr);
+        REQUIRE(mem1 != nullptr);
+        CHECK(mem0 != mem1);
+
+        pool.DeallocateRaw(mem0, 100);
+        pool.DeallocateRaw(mem1, 200);
+        CHECK(pool.UsedCount() == 0);
+    }
+
+    SECTION("Commits on demand")
+    {
+        sizet committed = pool.CommittedCount();
+        memptr mem = pool.AllocateRaw(1024 * 1024);
+
+        REQUIRE(mem != nullptr);
+        CHECK(pool.CommittedCount() > committed);
+        CHECK(pool.CommittedCount() <= pool.ReservedCount());
+    }
+
+    SECTION("Never grows beyond reserved memory")
+    {
+        CHECK(pool.AllocateRaw(reserveSize * 2) == nullptr);
+    }
+
+    SECTION("Fills the reserved range")
+    {
+        // doubling the pool stops fitting in the rest of the range halfway,
+        // expansions must fall back to adding just enough
+        constexpr sizet blockSize = 1024 * 1024;
+        sizet count = 0;
+        while (pool.AllocateRaw(blockSize, false) != nullptr)
+        {
+            count++;
+        }
+
+        CHECK(count * blockSize > reserveSize - 2 * blockSize);
+        CHECK(pool.CommittedCount() <= pool.ReservedCount());
+    }
+
+    SECTION("Huge pages")
+    {
+        VirtualMemPool hugePool(reserveSize, 1024, true);
+        memptr mem = hugePool.AllocateRaw(1024);
+
+        REQUIRE(mem != nullptr);
+        if (GetHugePageSize() != 0)
+        {
+            CHECK(hugePool.CommittedCount() % GetHugePageSize() == 0);
+        }
+    }
+
+    SECTION("Shrink keeps free memory usable")
+    {
+        sizet size = 4 * 1024 * 1024;
+        memptr mem = pool.AllocateRaw(size);
+        REQUIRE(mem != nullptr);
+        memset(mem, 1, size);
+
+        pool.DeallocateRaw(mem, size);
+        pool.Shrink();
+
+        mem = pool.AllocateRaw(size);
+        REQUIRE(mem != nullptr);
+        CHECK(SCAST(sizet, mem[size - 1]) == 0);
+    }
+
+    SECTION("Shrink discards memory only above the threshold")
+    {
+        // the used block keeps the chunk, so only pages of the free block can be discarded
+        sizet size = 4 * 1024 * 1024;
+        memptr mem = pool.AllocateRaw(size, false);
+        memptr used = pool.AllocateRaw(100);
+        REQUIRE(mem != nullptr);
+        REQUIRE(used != nullptr);
+        memset(mem, 1, size);
+        pool.DeallocateRaw(mem, size);
+
+        pool.SetShrinkHysteresis(2 * size, 0);
+        pool.Shrink();
+        CHECK(pool.AllocateRaw(size, false) == mem);
+        CHECK(SCAST(sizet, mem[size / 2]) == 1);
+        pool.DeallocateRaw(mem, size);
+
+        pool.SetShrinkHysteresis(0, 2 * size);
+        pool.Shrink();
+        CHECK(pool.AllocateRaw(size, false) == mem);
+        CHECK(SCAST(sizet, mem[size / 2]) == 1);
+        pool.DeallocateRaw(mem, size);
+
+        pool.SetShrinkHysteresis(0, 0);
+        pool.Shrink();
+        CHECK(pool.AllocateRaw(size, false) == mem);
+        CHECK(SCAST(sizet, mem[size / 2]) == 0);
+    }
+
+    SECTION("Cleared memory reads 0")
+    {
+        auto isZero = [](memptr mem, sizet size)
+        {
+            for (sizet i = 0; i < size; i++)
+            {
+                if (SCAST(sizet, mem[i]) != 0) return false;
+            }
+
+            return true;
+        };
+
+        // fresh memory, clearing skipped
+        memptr mems[8];
+        for (sizet i = 0; i < 8; i++)
+        {
+            mems[i] = pool.AllocateRaw(1000 + i * 100);
+            REQUIRE(mems[i] != nullptr);
+            CHECK(isZero(mems[i], 1000 + i * 100));
+            memset(mems[i], 1, 1000 + i * 100);
+        }
+
+        // dirty blocks joined with zero blocks
+        for (sizet i = 0; i < 8; i += 2)
+        {
+            pool.DeallocateRaw(mems[i], 0);
+        }
+
+        pool.DeallocateRaw(mems[7], 0);
+        for (sizet i = 0; i < 8; i += 2)
+        {
+            mems[i] = pool.AllocateRaw(900 + i * 100);
+            REQUIRE(mems[i] != nullptr);
+            CHECK(isZero(mems[i], 900 + i * 100));
+        }
+
+        // growing in place into a zero block
+        mems[6] = pool.ReallocateRaw(mems[6], 4000);
+        REQUIRE(mems[6] != nullptr);
+        CHECK(isZero(mems[6], 4000));
+
+        for (sizet i = 0; i < 7; i++)
+        {
+            pool.DeallocateRaw(mems[i], 0);
+        }
+
+        // memory cleared by Shrink(), then divided
+        sizet size = 1024 * 1024;
+        memptr mem = pool.AllocateRaw(size);
+        REQUIRE(mem != nullptr);
+        memset(mem, 1, size);
+        pool.DeallocateRaw(mem, size);
+        pool.Shrink();
+
+        for (sizet i = 0; i < 8; i++)
+        {
+            mems[i] = pool.AllocateRaw(size / 8 - 64);
+            REQUIRE(mems[i] != nullptr);
+            CHECK(isZero(mems[i], size / 8 - 64));
+        }
+    }
+
+    SECTION("Shrink decommits free chunks")
+    {
+        sizet committed = pool.CommittedCount();
+        memptr mem = pool.AllocateRaw(1024 * 1024);
+        REQUIRE(mem != nullptr);
+        REQUIRE(pool.CommittedCount() > committed);
+
+        pool.DeallocateRaw(mem, 1024 * 1024);
+        pool.Shrink();
+        CHECK(pool.CommittedCount() <= committed);
+    }
+
+    SECTION("Shrink leaves no holes in the reserved range")
+    {
+        // a free chunk below a used one must stay, releasing it would leave a hole
+        // which == never reused, and repeated cycles would use up the range
+        sizet committed = 0;
+        for (sizet i = 0; i < 200; i++)
+        {
+            memptr low = pool.AllocateRaw(1024 * 1024, false);
+            memptr high = pool.AllocateRaw(4 * 1024 * 1024, false);
+            REQUIRE(low != nullptr);
+            REQUIRE(high != nullptr);
+
+            committed = max(committed, pool.CommittedCount());
+            pool.DeallocateRaw(low, 1024 * 1024);
+            pool.Shrink();
+            pool.DeallocateRaw(high, 4 * 1024 * 1024);
+            pool.Shrink();
+        }
+
+        CHECK(pool.CommittedCount() < committed);
+        CHECK(committed < reserveSize / 4);
+    }
+}
\ No newline at end of file